@@ -0,0 +1,43 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "graph/Graph.hpp"                // Graph input
+#include <cstddef>                        // std::size_t
+#include <vector>                         // scores
+
+/**
+ * @brief Betweenness centrality with Brandes' algorithm (hop distances).
+ *        One BFS + dependency back-propagation per source; sources are
+ *        spread over the shared pool and every participant accumulates into
+ *        its own score array, summed once at the end (no atomics).
+ *        Approximate mode runs only k uniformly sampled sources and scales
+ *        by n/k. Each sampled dependency δ_s(v)/(n-2) lies in [0,1], so
+ *        Hoeffding + a union bound over all vertices gives, with probability
+ *        1-delta, |estimate - exact| <= n(n-2)·sqrt(ln(2n/delta) / (2k))
+ *        for every vertex at once; that bound is reported with the result.
+ *        Undirected scores count each unordered pair once.
+ */
+class Betweenness {
+public:
+    struct Options {
+        std::size_t samples = 0;              // sampled sources; 0 = exact (all sources)
+        double      epsilon = 0;              // alternatively: target normalised error → samples
+        double      delta   = 0.1;            // failure probability of the error bound
+        unsigned    seed    = 1;              // RNG seed for sampling
+        unsigned    threads = 0;              // participants; 0 = whole shared pool
+    };
+
+    struct Result {
+        std::vector<double> score;            // betweenness per vertex (raw, unnormalised)
+        std::size_t sources = 0;              // sources actually processed
+        bool        exact   = true;           // all sources were used
+        double      errorBound = 0;           // absolute bound on |score - exact| (approximate mode)
+    };
+
+    Betweenness() : m_opt() {}                                  // exact
+    explicit Betweenness(const Options& opt) : m_opt(opt) {}    // custom options
+
+    // Score every vertex of g.
+    Result compute(const Graph& g) const;
+
+private:
+    Options m_opt;                            // configuration for compute()
+};
@@ -0,0 +1,34 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "graph/Graph.hpp"                // Graph input
+#include <cstddef>                        // std::size_t
+#include <utility>                        // std::pair for bridges
+#include <vector>                         // result lists
+
+/**
+ * @brief Bridges, articulation points and biconnected blocks in one O(V+E) pass.
+ *        Tarjan's low-link DFS run with an explicit stack (like Hierholzer in
+ *        Euler.cpp), so long paths cannot overflow the call stack. Edge
+ *        direction is ignored; self-loops are skipped and parallel edges are
+ *        treated as back edges (so they are never bridges).
+ */
+class Biconnectivity {
+public:
+    struct BlockEdge {
+        Graph::Vertex u, v;                   // endpoints (u < v)
+        std::size_t   block;                  // biconnected block id in [0, blocks)
+    };
+
+    struct Result {
+        std::vector<std::pair<Graph::Vertex, Graph::Vertex>> bridges; // (u < v), sorted
+        std::vector<Graph::Vertex> articulationPoints;               // sorted cut vertices
+        std::vector<BlockEdge>     edges;                            // every undirected edge with its block
+        std::size_t blocks     = 0;                                  // number of biconnected blocks
+        std::size_t components = 0;                                  // connected components (isolated vertices count)
+
+        // True when the graph is connected and has no cut vertex.
+        bool biconnected() const { return components <= 1 && articulationPoints.empty(); }
+    };
+
+    // Run the low-link DFS over the undirected view of g.
+    Result compute(const Graph& g) const;
+};
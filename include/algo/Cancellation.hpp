@@ -0,0 +1,48 @@
+#pragma once                              // ensure this header is included only once per translation unit
+
+#include <atomic>                         // shared cancel flag
+#include <chrono>                         // deadlines
+#include <memory>                         // std::shared_ptr so copies observe the same flag
+
+// ==========================
+// Cooperative cancellation
+// ==========================
+// Long-running searches take a CancelToken and poll expired() every few
+// thousand steps; once it returns true they stop and report the best answer
+// found so far. A token expires when its deadline passes or when any copy
+// of it is cancel()ed (copies share one flag, so the requester can keep a
+// copy and cancel from another thread). A default token never expires and
+// costs one relaxed atomic load per poll.
+// ==========================
+
+class CancelToken {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Never expires on its own; cancel() still works.
+    CancelToken() : m_flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+    // Expires `budget` from now.
+    static CancelToken after(std::chrono::milliseconds budget) {
+        CancelToken t;
+        t.m_deadline = Clock::now() + budget;
+        t.m_hasDeadline = true;
+        return t;
+    }
+
+    // Ask every holder of this token to stop.
+    void cancel() noexcept { m_flag->store(true, std::memory_order_relaxed); }
+
+    // True once cancelled or past the deadline.
+    bool expired() const noexcept {
+        if (m_flag->load(std::memory_order_relaxed)) return true;
+        if (!m_hasDeadline || Clock::now() < m_deadline) return false;
+        m_flag->store(true, std::memory_order_relaxed);     // latch: later polls skip the clock
+        return true;
+    }
+
+private:
+    std::shared_ptr<std::atomic<bool>> m_flag;  // shared by all copies
+    Clock::time_point m_deadline{};             // valid when m_hasDeadline
+    bool m_hasDeadline = false;
+};
@@ -0,0 +1,44 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "graph/Graph.hpp"                // Graph input
+#include <cstddef>                        // std::size_t
+#include <vector>                         // color assignment
+
+/**
+ * @brief Greedy vertex coloring (edge direction and self-loops are ignored).
+ *        - LargestFirst:   greedy in non-increasing degree order.
+ *        - DSatur:         always colors the vertex seeing the most distinct
+ *                          colors (ties: higher degree, then lower id).
+ *        - JonesPlassmann: parallel rounds; every uncolored vertex whose
+ *                          random priority beats all uncolored neighbors
+ *                          takes its smallest free color. Winners of a round
+ *                          form an independent set, so the round needs no
+ *                          locks and the result is deterministic per seed.
+ *        Free colors are found in a reusable bitset: neighbor colors are set,
+ *        the first zero bit is read with one ctz per word, and only the bits
+ *        that were set are cleared again, so no per-vertex allocation happens.
+ */
+class GraphColoring {
+public:
+    enum class Method { LargestFirst, DSatur, JonesPlassmann };
+
+    struct Options {
+        Method   method  = Method::DSatur;     // heuristic
+        unsigned seed    = 1;                  // Jones–Plassmann priorities
+        unsigned threads = 0;                  // Jones–Plassmann participants; 0 = whole shared pool
+    };
+
+    struct Result {
+        std::size_t colors = 0;                // number of colors used
+        std::vector<std::size_t> color;        // color per vertex, 0-based
+        std::size_t rounds = 0;                // parallel rounds (Jones–Plassmann only)
+    };
+
+    GraphColoring() : m_opt() {}                                  // DSatur
+    explicit GraphColoring(const Options& opt) : m_opt(opt) {}    // custom options
+
+    // Color every vertex of g so that adjacent vertices differ.
+    Result compute(const Graph& g) const;
+
+private:
+    Options m_opt;                             // configuration for compute()
+};
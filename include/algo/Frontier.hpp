@@ -0,0 +1,243 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "algo/Parallel.hpp"              // parallel_for, parallel_slots on the shared pool
+#include "graph/Csr.hpp"                  // out- / in-neighbor views
+#include "graph/Graph.hpp"                // Graph input
+#include <atomic>                         // atomic update helpers
+#include <cstddef>                        // std::size_t
+#include <cstdint>                        // std::uint8_t flags
+#include <type_traits>                    // floating-point write_add
+#include <vector>                         // subsets, per-slot buffers
+
+// ==========================
+// Frontier engine: vertexMap / edgeMap (Ligra-style)
+// ==========================
+// Traversal algorithms are written as rounds over a VertexSubset frontier:
+// - vertexMap(U, f) runs f(v) for every v in U, in parallel.
+// - vertexFilter(U, pred) keeps the v in U for which pred(v) holds.
+// - vertexSum<T>(U, f) adds up f(v) over U (per-participant partial sums).
+// - edgeMap(G, U, F) applies F to the arcs leaving U and returns the
+//   targets F accepted as the next frontier.
+//
+// F supplies three members (u = source, v = target, both Csr::Index):
+//   bool cond(v)             still worth updating v?
+//   bool update(u, v)        pull mode: v is owned by the calling thread
+//   bool updateAtomic(u, v)  push mode: v may be updated concurrently
+// update* returns true when v should join the next frontier; a push-mode
+// F must return true at most once per v and round (use compare_and_swap or
+// write_min to decide), or v is listed twice.
+//
+// edgeMap picks the direction per round. A small frontier pushes along
+// out-arcs and produces a sparse id list. When the frontier and its
+// out-degree exceed arcs / denseDivisor, every v with cond(v) pulls from
+// its in-neighbors instead. No atomics are needed then, and v can stop at
+// the first accepting neighbor. The output is a dense flag array. Subsets
+// convert between the two forms on demand.
+// ==========================
+
+/**
+ * @brief Set of vertices, held either as an id list (sparse) or as one
+ *        flag byte per vertex (dense).
+ */
+class VertexSubset {
+public:
+    using Index = Csr::Index;
+
+    explicit VertexSubset(std::size_t n = 0) : m_n(n) {}     // empty, sparse
+
+    static VertexSubset single(std::size_t n, Index v);
+    static VertexSubset all(std::size_t n);
+    static VertexSubset fromIds(std::size_t n, std::vector<Index> ids);            // ids must be distinct
+    static VertexSubset fromFlags(std::vector<std::uint8_t> flags, std::size_t count);
+
+    std::size_t n() const noexcept { return m_n; }            // universe size
+    std::size_t size() const noexcept { return m_count; }     // members
+    bool empty() const noexcept { return m_count == 0; }
+    bool dense() const noexcept { return m_dense; }
+
+    // Switch representation (no-op when already in that form).
+    void toDense(unsigned maxThreads = 0);
+    void toSparse(unsigned maxThreads = 0);
+
+    // Members as ids (sparse form) / flags (dense form).
+    const std::vector<Index>&        ids() const noexcept { return m_ids; }
+    const std::vector<std::uint8_t>& flags() const noexcept { return m_flags; }
+
+    // Membership test (O(1) dense, O(size) sparse).
+    bool contains(Index v) const;
+
+private:
+    std::size_t               m_n = 0;       // universe [0, n)
+    std::size_t               m_count = 0;   // members
+    bool                      m_dense = false;
+    std::vector<Index>        m_ids;         // sparse members
+    std::vector<std::uint8_t> m_flags;       // dense membership
+};
+
+/**
+ * @brief Out- and in-neighbor views edgeMap walks (both from the graph's
+ *        artifact cache; for undirected graphs they are the same CSR).
+ */
+struct FrontierGraph {
+    const Csr& out;                       // push: arcs leaving u
+    const Csr& in;                        // pull: arcs entering v
+
+    static FrontierGraph of(const Graph& g);
+    std::size_t n() const noexcept { return out.n(); }
+};
+
+struct EdgeMapOptions {
+    std::size_t denseDivisor = 20;        // pull once |U| + outdeg(U) > arcs / denseDivisor
+    bool        output       = true;      // false: only run F, return an empty subset
+    unsigned    threads      = 0;         // participants; 0 = whole shared pool
+};
+
+// ---------------- atomic update helpers ----------------
+
+template <class T>
+inline bool compare_and_swap(std::atomic<T>& a, T expected, T desired) noexcept {
+    return a.compare_exchange_strong(expected, desired, std::memory_order_relaxed);
+}
+
+// Lower a to v; true if this call lowered it.
+template <class T>
+inline bool write_min(std::atomic<T>& a, T v) noexcept {
+    T cur = a.load(std::memory_order_relaxed);
+    while (v < cur)
+        if (a.compare_exchange_weak(cur, v, std::memory_order_relaxed)) return true;
+    return false;
+}
+
+// a += v, also for floating-point T (CAS loop).
+template <class T>
+inline void write_add(std::atomic<T>& a, T v) noexcept {
+    if constexpr (std::is_integral_v<T>) {
+        a.fetch_add(v, std::memory_order_relaxed);
+    } else {
+        T cur = a.load(std::memory_order_relaxed);
+        while (!a.compare_exchange_weak(cur, cur + v, std::memory_order_relaxed)) {}
+    }
+}
+
+// ---------------- vertexMap / vertexFilter ----------------
+
+inline constexpr std::size_t kFrontierGrain = 1024;          // vertices per parallel_for chunk
+
+template <class F>
+void vertexMap(const VertexSubset& U, F&& f, unsigned maxThreads = 0) {
+    if (U.dense()) {
+        const auto& in = U.flags();
+        parallel_for(U.n(), kFrontierGrain, [&](std::size_t lo, std::size_t hi, unsigned) {
+            for (std::size_t v = lo; v < hi; ++v)
+                if (in[v]) f(static_cast<VertexSubset::Index>(v));
+        }, maxThreads);
+    } else {
+        const auto& ids = U.ids();
+        parallel_for(ids.size(), kFrontierGrain, [&](std::size_t lo, std::size_t hi, unsigned) {
+            for (std::size_t i = lo; i < hi; ++i) f(ids[i]);
+        }, maxThreads);
+    }
+}
+
+template <class P>
+VertexSubset vertexFilter(const VertexSubset& U, P&& pred, unsigned maxThreads = 0) {
+    std::vector<std::uint8_t> out(U.n(), 0);
+    std::vector<std::size_t> counts(parallel_slots(maxThreads), 0);
+    auto keep = [&](std::size_t v, unsigned slot) {
+        if (pred(static_cast<VertexSubset::Index>(v))) { out[v] = 1; ++counts[slot]; }
+    };
+    if (U.dense()) {
+        const auto& in = U.flags();
+        parallel_for(U.n(), kFrontierGrain, [&](std::size_t lo, std::size_t hi, unsigned slot) {
+            for (std::size_t v = lo; v < hi; ++v) if (in[v]) keep(v, slot);
+        }, maxThreads);
+    } else {
+        const auto& ids = U.ids();
+        parallel_for(ids.size(), kFrontierGrain, [&](std::size_t lo, std::size_t hi, unsigned slot) {
+            for (std::size_t i = lo; i < hi; ++i) keep(ids[i], slot);
+        }, maxThreads);
+    }
+    std::size_t count = 0;
+    for (std::size_t c : counts) count += c;
+    return VertexSubset::fromFlags(std::move(out), count);
+}
+
+template <class T, class F>
+T vertexSum(const VertexSubset& U, F&& f, unsigned maxThreads = 0) {
+    std::vector<T> partial(parallel_slots(maxThreads), T{});
+    if (U.dense()) {
+        const auto& in = U.flags();
+        parallel_for(U.n(), kFrontierGrain, [&](std::size_t lo, std::size_t hi, unsigned slot) {
+            T s{};
+            for (std::size_t v = lo; v < hi; ++v) if (in[v]) s += f(static_cast<VertexSubset::Index>(v));
+            partial[slot] += s;
+        }, maxThreads);
+    } else {
+        const auto& ids = U.ids();
+        parallel_for(ids.size(), kFrontierGrain, [&](std::size_t lo, std::size_t hi, unsigned slot) {
+            T s{};
+            for (std::size_t i = lo; i < hi; ++i) s += f(ids[i]);
+            partial[slot] += s;
+        }, maxThreads);
+    }
+    T total{};
+    for (const T& p : partial) total += p;
+    return total;
+}
+
+// ---------------- edgeMap ----------------
+
+// Sum of out-degrees of U (decides the direction).
+std::size_t frontier_out_degree(const FrontierGraph& G, const VertexSubset& U, unsigned maxThreads = 0);
+
+template <class F>
+VertexSubset edgeMap(const FrontierGraph& G, VertexSubset& U, F& f, const EdgeMapOptions& opt = {}) {
+    using Index = VertexSubset::Index;
+    const std::size_t n = G.n();
+    const unsigned slots = parallel_slots(opt.threads);
+    if (U.empty()) return VertexSubset(n);
+
+    const std::size_t work = U.size() + frontier_out_degree(G, U, opt.threads);
+    if (work > G.out.arcs() / (opt.denseDivisor ? opt.denseDivisor : 1)) {
+        // ---- dense pull: each v gathers from in-neighbors in U ----
+        U.toDense(opt.threads);
+        const auto& inU = U.flags();
+        std::vector<std::uint8_t> next(opt.output ? n : 0, 0);
+        std::vector<std::size_t> counts(slots, 0);
+        parallel_for(n, kFrontierGrain, [&](std::size_t lo, std::size_t hi, unsigned slot) {
+            for (std::size_t v = lo; v < hi; ++v) {
+                const Index d = static_cast<Index>(v);
+                if (!f.cond(d)) continue;
+                for (std::size_t p = G.in.offsets[v]; p < G.in.offsets[v + 1]; ++p) {
+                    const Index s = G.in.targets[p];
+                    if (inU[s] && f.update(s, d) && opt.output && !next[v]) { next[v] = 1; ++counts[slot]; }
+                    if (!f.cond(d)) break;                  // v is done: skip its other in-arcs
+                }
+            }
+        }, opt.threads);
+        if (!opt.output) return VertexSubset(n);
+        std::size_t count = 0;
+        for (std::size_t c : counts) count += c;
+        return VertexSubset::fromFlags(std::move(next), count);
+    }
+
+    // ---- sparse push: each u in U scatters along its out-arcs ----
+    U.toSparse(opt.threads);
+    const auto& ids = U.ids();
+    std::vector<std::vector<Index>> local(opt.output ? slots : 0);  // per-participant outputs
+    parallel_for(ids.size(), 64, [&](std::size_t lo, std::size_t hi, unsigned slot) {
+        for (std::size_t i = lo; i < hi; ++i) {
+            const Index s = ids[i];
+            for (std::size_t p = G.out.offsets[s]; p < G.out.offsets[s + 1]; ++p) {
+                const Index d = G.out.targets[p];
+                if (f.cond(d) && f.updateAtomic(s, d) && opt.output) local[slot].push_back(d);
+            }
+        }
+    }, opt.threads);
+    if (!opt.output) return VertexSubset(n);
+    std::vector<Index> next;
+    std::size_t total = 0;
+    for (const auto& l : local) total += l.size();
+    next.reserve(total);
+    for (const auto& l : local) next.insert(next.end(), l.begin(), l.end());
+    return VertexSubset::fromIds(n, std::move(next));
+}
@@ -0,0 +1,91 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "algo/Frontier.hpp"              // VertexSubset, edgeMap, EdgeMapOptions
+#include "algo/PageRank.hpp"              // PageRank::Options / Result
+#include "graph/Graph.hpp"                // Graph input
+#include <atomic>                         // MinLabelF state
+#include <cstddef>                        // std::size_t
+#include <cstdint>                        // std::uint8_t claim flags
+#include <vector>                         // per-vertex results
+
+/**
+ * @brief Breadth-first search from one source written on the frontier engine:
+ *        one edgeMap per level, pushing from small frontiers and pulling
+ *        (first parent wins) once the frontier is large. Follows arc direction.
+ */
+class FrontierBfs {
+public:
+    struct Result {
+        std::vector<long long> level;         // hops from the source; -1 = unreachable
+        std::vector<long long> parent;        // BFS tree parent; -1 for the source and unreachable vertices
+        std::size_t reached     = 0;          // vertices reached (incl. the source)
+        std::size_t rounds      = 0;          // edgeMap calls
+        std::size_t denseRounds = 0;          // of which ran in pull mode
+    };
+
+    FrontierBfs() : m_opt() {}
+    explicit FrontierBfs(const EdgeMapOptions& opt) : m_opt(opt) {}
+
+    // Throws std::out_of_range for a source outside g.
+    Result compute(const Graph& g, Graph::Vertex source) const;
+
+private:
+    EdgeMapOptions m_opt;
+};
+
+/**
+ * @brief edgeMap functor of FrontierComponents: pushes the smaller label
+ *        along an arc. In push mode v joins the next frontier only for the
+ *        call that first lowers its label in a round, decided by claiming
+ *        claimed[v]. The caller clears claimed[] for the new frontier after
+ *        each round.
+ */
+struct MinLabelF {
+    using Index = VertexSubset::Index;
+
+    std::vector<std::atomic<Index>>&        label;     // current label per vertex
+    std::vector<std::atomic<std::uint8_t>>& claimed;   // v already in this round's output
+
+    bool cond(Index) const { return true; }
+    bool update(Index u, Index v);
+    bool updateAtomic(Index u, Index v);
+};
+
+/**
+ * @brief Connected components by label propagation on the frontier engine:
+ *        every vertex starts with its own id, and vertices whose label
+ *        dropped in the last round push it (write_min) to their neighbors.
+ *        Directed graphs give weakly connected components. Each label ends
+ *        as the smallest vertex id of its component.
+ */
+class FrontierComponents {
+public:
+    struct Result {
+        std::vector<Graph::Vertex> label;     // smallest vertex id of the component
+        std::size_t components = 0;           // distinct labels
+        std::size_t rounds     = 0;           // edgeMap calls
+    };
+
+    FrontierComponents() : m_opt() {}
+    explicit FrontierComponents(const EdgeMapOptions& opt) : m_opt(opt) {}
+
+    Result compute(const Graph& g) const;
+
+private:
+    EdgeMapOptions m_opt;
+};
+
+/**
+ * @brief PageRank as vertexMap / edgeMap rounds (same iteration, dangling
+ *        handling and stopping rule as PageRank, without its cache blocking,
+ *        relabelling or float mode). Useful as the engine's reference port.
+ */
+class FrontierPageRank {
+public:
+    FrontierPageRank() : m_opt() {}
+    explicit FrontierPageRank(const PageRank::Options& opt) : m_opt(opt) {}
+
+    PageRank::Result compute(const Graph& g) const;
+
+private:
+    PageRank::Options m_opt;
+};
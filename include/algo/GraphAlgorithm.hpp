@@ -1,7 +1,11 @@
 #pragma once
 #include "graph/Graph.hpp"      // your project Graph
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 // Strategy interface all algorithms implement
 struct IGraphAlgorithm {
@@ -9,8 +13,75 @@ struct IGraphAlgorithm {
     virtual std::string run(const Graph& g) = 0;
 };
 
+// Every algorithm the factory knows, as X(Id, "NAME"). This list is the one
+// registration point: ids, names and dispatch tables all derive from it.
+// The strategy types live in AlgorithmFactory.cpp, so a new algorithm
+// takes a line here plus its strategy and a REGISTER_GRAPH_ALGORITHM(Id, ...)
+// line there. That macro is an internal helper of AlgorithmFactory.cpp,
+// not a plug-in hook for other files. An id without a registration does
+// not compile.
+#define GRAPH_ALGORITHM_LIST(X)            \
+    X(Mst,          "MST")                 \
+    X(Scc,          "SCC")                 \
+    X(MaxFlow,      "MAXFLOW")             \
+    X(Hamilton,     "HAMILTON")            \
+    X(PageRank,     "PAGERANK")            \
+    X(Matching,     "MATCHING")            \
+    X(Biconnected,  "BICONNECTED")         \
+    X(Reach,        "REACH")               \
+    X(MinCostFlow,  "MINCOSTFLOW")         \
+    X(Diameter,     "DIAMETER")            \
+    X(Eccentricity, "ECCENTRICITY")        \
+    X(Closeness,    "CLOSENESS")           \
+    X(Betweenness,  "BETWEENNESS")         \
+    X(Coloring,     "COLORING")            \
+    X(MaxClique,    "MAXCLIQUE")           \
+    X(Bfs,          "BFS")                 \
+    X(Components,   "COMPONENTS")          \
+    X(Sssp,         "SSSP")
+
+// Algorithm ids, parsed once from a name (see AlgorithmFactory::parseId)
+enum class AlgorithmId : unsigned char {
+#define GRAPH_ALGORITHM_ENUM(id, name) id,
+    GRAPH_ALGORITHM_LIST(GRAPH_ALGORITHM_ENUM)
+#undef GRAPH_ALGORITHM_ENUM
+};
+
+#define GRAPH_ALGORITHM_ONE(id, name) + 1
+inline constexpr std::size_t kAlgorithmCount = 0 GRAPH_ALGORITHM_LIST(GRAPH_ALGORITHM_ONE);
+#undef GRAPH_ALGORITHM_ONE
+
+// Canonical (upper-case) name per id, in AlgorithmId order
+#define GRAPH_ALGORITHM_NAME(id, name) std::string_view(name),
+inline constexpr std::array<std::string_view, kAlgorithmCount> kAlgorithmNames = {{
+    GRAPH_ALGORITHM_LIST(GRAPH_ALGORITHM_NAME)
+}};
+#undef GRAPH_ALGORITHM_NAME
+
 // Factory that returns a concrete strategy by name
-// Accepts: "MST", "SCC", "MAXFLOW", "HAMILTON" (case-insensitive)
+// Accepts: "MST", "SCC", "MAXFLOW", "HAMILTON", "PAGERANK", "MATCHING",
+//          "BICONNECTED", "REACH", "MINCOSTFLOW", "DIAMETER", "ECCENTRICITY",
+//          "CLOSENESS", "BETWEENNESS", "COLORING", "MAXCLIQUE", "BFS",
+//          "COMPONENTS", "SSSP" (case-insensitive)
+// Options may follow the name, separated by spaces or as "NAME:opt,opt"
+// (e.g. "PAGERANK:tol=1e-8,float", "SCC:dag", "REACH:0-3,2-5",
+// "MINCOSTFLOW 0 5 10"); unknown names or bad options → nullptr.
+// Servers with a fixed set of algorithms keep AlgorithmIds and call run(),
+// which dispatches through a static table without allocating a strategy.
 struct AlgorithmFactory {
     static std::unique_ptr<IGraphAlgorithm> create(const std::string& name);
+
+    // Strategy `id` configured from option tokens; bad options → nullptr.
+    static std::unique_ptr<IGraphAlgorithm> create(AlgorithmId id, const std::vector<std::string>& args);
+
+    // Case-insensitive name → id without allocating; false for unknown names.
+    static bool parseId(std::string_view name, AlgorithmId& id) noexcept;
+
+    // Canonical upper-case name of `id`.
+    static constexpr std::string_view name(AlgorithmId id) noexcept {
+        return kAlgorithmNames[static_cast<std::size_t>(id)];
+    }
+
+    // Run `id` with its default options on g (no heap-allocated strategy).
+    static std::string run(AlgorithmId id, const Graph& g);
 };
@@ -0,0 +1,41 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "graph/Graph.hpp"                // Graph input
+#include <cstddef>                        // std::size_t
+#include <utility>                        // std::pair for matched edges
+#include <vector>                         // colors, pairs
+
+/**
+ * @brief Maximum-cardinality matching on bipartite graphs (Hopcroft–Karp).
+ *        First 2-colors the graph with a level-synchronous parallel BFS (edge
+ *        direction is ignored); an odd cycle makes the graph non-bipartite and
+ *        no matching is computed. Otherwise an optional greedy or Karp–Sipser
+ *        pass seeds the matching and Hopcroft–Karp finishes it in O(E·√V).
+ */
+class BipartiteMatching {
+public:
+    enum class Init { None, Greedy, KarpSipser };   // seeding heuristic before Hopcroft–Karp
+
+    struct Options {
+        Init     init    = Init::KarpSipser;        // initial matching heuristic
+        unsigned threads = 0;                       // BFS participants; 0 = whole shared pool
+    };
+
+    struct Result {
+        bool bipartite = false;                     // false → odd cycle found
+        std::vector<signed char> side;              // 0/1 color per vertex (valid if bipartite)
+        std::pair<Graph::Vertex, Graph::Vertex> conflict{0, 0}; // an edge inside one color class
+        std::size_t size = 0;                       // matching cardinality
+        std::vector<std::pair<Graph::Vertex, Graph::Vertex>> pairs; // (side-0, side-1) vertex pairs
+        std::size_t initialSize = 0;                // pairs found by the seeding heuristic
+        std::size_t phases = 0;                     // Hopcroft–Karp BFS phases
+    };
+
+    BipartiteMatching() : m_opt() {}                                  // default options
+    explicit BipartiteMatching(const Options& opt) : m_opt(opt) {}    // custom options
+
+    // Color g, then compute a maximum matching if it is bipartite.
+    Result compute(const Graph& g) const;
+
+private:
+    Options m_opt;                                  // configuration for compute()
+};
@@ -0,0 +1,45 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "algo/Cancellation.hpp"          // CancelToken for deadlines
+#include "graph/Graph.hpp"                // Graph input
+#include <cstddef>                        // std::size_t
+#include <vector>                         // clique vertices
+
+/**
+ * @brief Exact maximum clique, branch and bound in the MCS/BBMC style.
+ *        Vertices are renumbered by the greedy coloring of the whole graph
+ *        (non-increasing degree first), and adjacency is stored as rows of
+ *        64-bit words. Each search node colors its candidate set with word
+ *        operations only; a vertex whose color class cannot lift the current
+ *        clique above the incumbent ends the node. Candidate sets are
+ *        narrowed with word-wise ANDs that the compiler vectorises.
+ *        Top-level branches are spread over the shared pool and share an
+ *        atomic incumbent, so a good clique found by one participant prunes
+ *        all others at once.
+ *        Edge direction and self-loops are ignored. The search polls
+ *        Options::cancel and, once it expires, returns the best clique found
+ *        with optimal = false.
+ */
+class MaxClique {
+public:
+    struct Options {
+        unsigned    threads     = 0;          // participants; 0 = whole shared pool
+        std::size_t maxVertices = 16384;      // bitset rows are n²/8 bytes (32 MB here)
+        CancelToken cancel;                   // deadline / external cancellation
+    };
+
+    struct Result {
+        std::vector<Graph::Vertex> clique;    // vertices of the best clique, ascending
+        bool        optimal = true;           // false if the search was cut short
+        std::size_t nodes   = 0;              // search nodes expanded
+        std::size_t colorBound = 0;           // colors of the initial greedy coloring (upper bound)
+    };
+
+    MaxClique() : m_opt() {}                                  // default options
+    explicit MaxClique(const Options& opt) : m_opt(opt) {}    // custom options
+
+    // Find a maximum clique of g; throws std::length_error above maxVertices.
+    Result compute(const Graph& g) const;
+
+private:
+    Options m_opt;                            // configuration for compute()
+};
@@ -0,0 +1,35 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "graph/Graph.hpp"                // Graph input (weight = capacity, cost attribute)
+#include <cstddef>                        // std::size_t
+#include <limits>                         // "no limit" default
+#include <tuple>                          // per-arc flow records
+#include <vector>                         // residual arrays, results
+
+/**
+ * @brief Minimum-cost flow by successive shortest paths.
+ *        Edge weight is the capacity, Graph::cost() the per-unit cost; an
+ *        undirected edge is two opposite arcs with the same capacity/cost.
+ *        The residual network is a flat structure of arrays (target,
+ *        capacity, cost, reverse slot) grouped by tail. Johnson potentials
+ *        keep reduced costs non-negative, so every round is a Dijkstra over
+ *        a radix heap (monotone integer keys, O(log C) amortised per pop).
+ *        Negative costs are allowed: initial potentials come from
+ *        Bellman–Ford, which also rejects negative cycles.
+ */
+class MinCostFlow {
+public:
+    using Weight = Graph::Weight;
+
+    struct Result {
+        bool  negativeCycle = false;            // costs admit a negative cycle → nothing computed
+        Weight flow  = 0;                       // units sent s -> t
+        Weight cost  = 0;                       // total cost of that flow
+        std::size_t augmentations = 0;          // shortest-path rounds
+        std::vector<std::tuple<Graph::Vertex, Graph::Vertex, Weight>> arcs; // (u, v, flow) with flow > 0
+    };
+
+    // Send up to `limit` units from s to t at minimum cost (default: a maximum flow).
+    // Throws std::invalid_argument when an arc has a negative capacity.
+    Result compute(const Graph& g, Graph::Vertex s, Graph::Vertex t,
+                   Weight limit = std::numeric_limits<Weight>::max()) const;
+};
@@ -0,0 +1,43 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "graph/Graph.hpp"                // Graph input
+#include <cstddef>                        // std::size_t
+#include <cstdint>                        // std::uint64_t distance sums
+#include <vector>                         // per-source results
+
+/**
+ * @brief Multi-source BFS (MS-BFS): up to 512 BFS traversals share one sweep.
+ *        Every vertex keeps a bitset with one lane per source in the batch
+ *        (seen / frontier / next), so a single adjacency scan advances all
+ *        sources whose frontier contains that vertex with a few word ORs.
+ *        Batches are independent and run in parallel on the shared pool.
+ *        Out-arcs are followed (hop distances; weights are ignored).
+ *        Per source it records what eccentricity / closeness need, not the
+ *        full distance rows.
+ */
+class MultiSourceBfs {
+public:
+    struct Options {
+        unsigned width   = 256;               // max sources per batch: 64..512, multiple of 64
+        unsigned threads = 0;                 // batch participants; 0 = whole shared pool
+    };
+
+    struct Result {
+        std::vector<std::size_t>   eccentricity; // largest finite distance from each source
+        std::vector<std::size_t>   reached;      // vertices reachable from each source (incl. itself)
+        std::vector<std::uint64_t> distanceSum;  // sum of distances to the reached vertices
+        std::size_t batches = 0;                 // sweeps performed
+        unsigned    width   = 0;                 // lanes per batch actually used
+    };
+
+    MultiSourceBfs() : m_opt() {}                                  // default options
+    explicit MultiSourceBfs(const Options& opt) : m_opt(opt) {}    // custom options
+
+    // BFS from every vertex of g; result index = vertex.
+    Result compute(const Graph& g) const;
+
+    // BFS from each listed source; result index = position in `sources`.
+    Result compute(const Graph& g, const std::vector<Graph::Vertex>& sources) const;
+
+private:
+    Options m_opt;                            // configuration for compute()
+};
@@ -0,0 +1,78 @@
+#pragma once                              // ensure this header is included only once per translation unit
+
+#include <atomic>                         // std::atomic counters for idle workers
+#include <condition_variable>             // std::condition_variable for the task queue
+#include <cstddef>                        // std::size_t
+#include <deque>                          // std::deque as the FIFO task queue
+#include <functional>                     // std::function for tasks and loop bodies
+#include <mutex>                          // std::mutex guarding the queue
+#include <thread>                         // std::thread workers
+#include <vector>                         // std::vector of workers
+
+class CpuPlacement;                       // sys/Topology.hpp
+
+// ==========================
+// Shared worker pool + parallel_for / parallel_invoke
+// ==========================
+// One process-wide pool (ThreadPool::shared()) is used by every parallel
+// algorithm so concurrent requests do not each spawn their own threads.
+// parallel_for() lets the *calling* thread take part in the loop: helpers
+// only pick up chunks nobody has claimed yet, so a loop started from a pool
+// worker (nested parallelism) still finishes even when the pool is busy.
+// ==========================
+
+class ThreadPool {
+public:
+    // Start `threads` workers (at least one).
+    explicit ThreadPool(unsigned threads);
+
+    // Stop accepting work, finish queued tasks and join all workers.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Process-wide pool sized to the hardware (created on first use).
+    static ThreadPool& shared();
+
+    // Number of worker threads.
+    unsigned size() const noexcept { return static_cast<unsigned>(m_workers.size()); }
+
+    // Workers currently parked waiting for a task (a hint, may be stale).
+    unsigned idle() const noexcept { return m_idle.load(std::memory_order_relaxed); }
+
+    // Enqueue a fire-and-forget task.
+    void submit(std::function<void()> task);
+
+    // Pin worker i as thread i + 1 of `placement` (thread 0 is the caller of
+    // parallel loops). Returns how many workers the OS accepted.
+    unsigned pin(const CpuPlacement& placement);
+
+private:
+    void workerLoop();                          // body of every worker thread
+
+    std::vector<std::thread> m_workers;         // owned worker threads
+    std::deque<std::function<void()>> m_tasks; // pending tasks (FIFO)
+    std::mutex m_mu;                            // protects m_tasks and m_stop
+    std::condition_variable m_cv;               // wakes workers on new tasks / stop
+    std::atomic<unsigned> m_idle{0};            // parked worker count
+    bool m_stop = false;                        // set by the destructor
+};
+
+// Number of participants parallel_for() may use for a given cap
+// (0 = caller + every pool worker). Size per-participant scratch with this.
+unsigned parallel_slots(unsigned maxThreads = 0);
+
+// Run body(lo, hi, slot) over [0, n) in chunks of `grain` items on the shared
+// pool. `slot` is a dense participant index in [0, parallel_slots(maxThreads))
+// that is stable for one participant, so callers can keep per-thread
+// accumulators without locking. Returns once every chunk has been processed.
+void parallel_for(std::size_t n, std::size_t grain,
+                  const std::function<void(std::size_t lo, std::size_t hi, unsigned slot)>& body,
+                  unsigned maxThreads = 0);
+
+// Fork-join: run every task exactly once and return when all have finished.
+// The caller runs tasks too, and at most `maxThreads` of them run at the same
+// time (0 = caller + every pool worker). Pass 1 + ThreadPool::shared().idle()
+// to only borrow workers that are free right now.
+void parallel_invoke(const std::vector<std::function<void()>>& tasks, unsigned maxThreads = 0);
@@ -0,0 +1,64 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "graph/Graph.hpp"                // Graph input
+#include <cstddef>                        // std::size_t
+#include <cstdint>                        // std::uint64_t bit rows, std::uint32_t labels
+#include <utility>                        // std::pair queries
+#include <vector>                         // index storage
+
+/**
+ * @brief Reachability index for repeated "can u reach v?" queries.
+ *        SCCs are condensed first (StrongComponents ids are a topological
+ *        order, so a query whose source comes later than its target is an
+ *        instant "no"). The condensation is then indexed either by
+ *        - Closure:  full transitive closure as 64-bit word bit rows, built by
+ *                    OR-ing successor rows level by level (every word op
+ *                    answers 64 sources at once, wide loops vectorise);
+ *                    queries are one bit test.
+ *        - Interval: GRAIL-style random DFS interval labels (a few words per
+ *                    component); non-containment answers "no" in O(labels),
+ *                    a DFS-tree interval answers most "yes" in O(1), and the
+ *                    rest fall back to a label-pruned DFS.
+ *        Auto picks the closure while it fits in Options::closureLimit components.
+ */
+class ReachabilityIndex {
+public:
+    enum class Mode { Auto, Closure, Interval };
+
+    struct Options {
+        Mode        mode         = Mode::Auto; // index kind
+        std::size_t closureLimit = 16384;      // max components for the closure (≈32 MB of bits)
+        unsigned    labels       = 3;          // random interval labelings (Interval mode)
+        unsigned    seed         = 1;          // RNG seed for the labelings
+        unsigned    threads      = 0;          // build/batch participants; 0 = whole shared pool
+    };
+
+    // Build the index for g (g is not referenced afterwards).
+    explicit ReachabilityIndex(const Graph& g);
+    ReachabilityIndex(const Graph& g, const Options& opt);
+
+    // True if there is a directed path u ->* v (u reaches itself).
+    bool reachable(Graph::Vertex u, Graph::Vertex v) const;
+
+    // Answer many queries on the shared pool; out[i] = reachable(q[i]).
+    std::vector<char> query(const std::vector<std::pair<Graph::Vertex, Graph::Vertex>>& q) const;
+
+    Mode        mode()       const noexcept { return m_mode; }        // Closure or Interval
+    std::size_t components() const noexcept { return m_succOff.empty() ? 0 : m_succOff.size() - 1; }
+    std::size_t bytes()      const noexcept;                          // index footprint (labels/bits)
+
+private:
+    void buildClosure();                                              // bit rows
+    void buildIntervals();                                            // GRAIL labels
+    bool searchIntervals(std::size_t cu, std::size_t cv, std::vector<std::uint32_t>& stamp,
+                         std::uint32_t mark, std::vector<std::size_t>& stack) const;
+
+    Options m_opt;                             // configuration
+    Mode m_mode = Mode::Closure;               // resolved kind
+    std::vector<std::size_t> m_comp;           // SCC id per vertex (topological)
+    std::vector<std::size_t> m_succOff;        // condensation DAG (CSR)
+    std::vector<std::size_t> m_succ;
+    std::size_t m_words = 0;                   // words per closure row
+    std::vector<std::uint64_t> m_bits;         // closure rows, m_words each
+    std::vector<std::uint32_t> m_low, m_post;  // labels: m_opt.labels entries per component
+    std::vector<std::uint32_t> m_pre, m_end;   // DFS-tree interval of labeling 0 (positive cut)
+};
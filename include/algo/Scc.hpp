@@ -0,0 +1,44 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "graph/Graph.hpp"                // Graph input
+#include <cstddef>                        // std::size_t
+#include <vector>                         // labels, CSR arrays
+
+/**
+ * @brief Strongly connected components with Tarjan's algorithm (explicit stack).
+ *        Tarjan emits components in reverse topological order of the
+ *        condensation, so numbering them backwards yields ids that already
+ *        are a topological order. On request the same pass also produces the
+ *        condensation DAG in CSR form with deduplicated inter-component arcs.
+ *        Undirected graphs: every connected component is one SCC.
+ *        of() shares the labels-only result through the graph's artifact cache.
+ */
+class StrongComponents {
+public:
+    struct Options {
+        bool condensation = false;            // also build the DAG + topological order
+    };
+
+    struct Result {
+        std::size_t count = 0;                // number of SCCs
+        std::vector<std::size_t> component;   // SCC id per vertex (ids are topologically ordered)
+        // Filled only when Options::condensation is set:
+        std::vector<std::size_t> dagOffsets;  // count+1 row starts of the condensation
+        std::vector<std::size_t> dagTargets;  // successor components, sorted per row, no duplicates
+        std::vector<std::size_t> topoOrder;   // components, sources first
+
+        // Number of arcs in the condensation DAG.
+        std::size_t dagArcs() const noexcept { return dagTargets.size(); }
+    };
+
+    StrongComponents() : m_opt() {}                                 // labels only
+    explicit StrongComponents(const Options& opt) : m_opt(opt) {}   // custom options
+
+    // Label every vertex of g with its SCC (and optionally condense).
+    Result compute(const Graph& g) const;
+
+    // Labels-only result for g from its artifact cache (built on first use).
+    static const Result& of(const Graph& g);
+
+private:
+    Options m_opt;                            // configuration for compute()
+};
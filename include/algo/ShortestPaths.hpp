@@ -0,0 +1,37 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "algo/Frontier.hpp"              // EdgeMapOptions (direction rule, threads)
+#include "algo/SparseLinear.hpp"          // min-plus semiring kernels
+#include "graph/Graph.hpp"                // Graph input
+#include <cstddef>                        // std::size_t
+#include <vector>                         // per-vertex distances
+
+/**
+ * @brief Single-source shortest paths as repeated x·A over the (min, +)
+ *        semiring (Bellman–Ford). x holds the vertices whose distance dropped
+ *        in the last round. Small x goes through spmspv, and large x through
+ *        a dense spmv (same switch as edgeMap: |x| + outdeg(x) >
+ *        arcs / denseDivisor). Negative weights are allowed. A negative cycle
+ *        reachable from the source is reported instead of distances.
+ */
+class ShortestPaths {
+public:
+    using Distance = Graph::Weight;
+    static constexpr Distance kUnreached = semiring::MinPlus<Distance>::zero();
+
+    struct Result {
+        std::vector<Distance> dist;           // kUnreached = no path
+        std::size_t reached       = 0;        // vertices with a path (incl. the source)
+        std::size_t rounds        = 0;        // x·A products
+        std::size_t denseRounds   = 0;        // of which ran as dense spmv
+        bool        negativeCycle = false;    // dist is not meaningful when set
+    };
+
+    ShortestPaths() : m_opt() {}
+    explicit ShortestPaths(const EdgeMapOptions& opt) : m_opt(opt) {}   // `output` is unused
+
+    // Throws std::out_of_range for a source outside g.
+    Result compute(const Graph& g, Graph::Vertex source) const;
+
+private:
+    EdgeMapOptions m_opt;
+};
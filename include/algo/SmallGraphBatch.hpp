@@ -0,0 +1,71 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "graph/Graph.hpp"                // Graph conversion / fallback
+#include "algo/GraphAlgorithm.hpp"        // AlgorithmId
+#include <cstddef>                        // std::size_t
+#include <cstdint>                        // std::uint64_t masks, compact ids
+#include <string>                         // per-graph replies
+#include <vector>                         // arena arrays
+
+/**
+ * @brief Many tiny graphs (at most 64 vertices each) answered in one call.
+ *        All graphs live in one contiguous arena: row u of a graph is a
+ *        64-bit mask of its out-neighbors (undirected graphs set both
+ *        directions, like Graph::adj()), and its weighted arcs are appended
+ *        to one shared arc array. MST, SCC, MAXFLOW and HAMILTON run as
+ *        specialised mask kernels with fixed-size scratch per participant
+ *        (no Graph, no strategy object, no allocation per graph). Their
+ *        replies are the same text the regular strategies produce.
+ *        Any other algorithm falls back to building a Graph and using
+ *        AlgorithmFactory::run(). Graphs are spread over the shared pool in
+ *        chunks.
+ */
+class SmallGraphBatch {
+public:
+    using Mask = std::uint64_t;
+    static constexpr std::size_t kMaxVertices = 64;   // one mask word per row
+
+    struct Arc {
+        std::uint8_t  u, v;                   // endpoints (u-v once for undirected graphs)
+        Graph::Weight w;                      // weight / capacity
+    };
+
+    // Start a new, edgeless graph with n vertices (1..64); returns its index.
+    // Throws std::invalid_argument for other sizes.
+    std::size_t addGraph(std::size_t n, bool directed);
+
+    // Add edge u-v (arc u->v if directed) to the most recently added graph.
+    // Returns false for a missing graph, bad endpoints, a self-loop or a duplicate.
+    bool addEdge(std::size_t u, std::size_t v, Graph::Weight w = 1);
+
+    std::size_t size() const noexcept { return m_graphs.size(); }
+    std::size_t vertices(std::size_t i) const { return m_graphs[i].n; }
+    bool        directed(std::size_t i) const { return m_graphs[i].directed; }
+
+    // Out-neighbor mask of vertex u in graph i.
+    Mask row(std::size_t i, std::size_t u) const { return m_rows[m_graphs[i].row + u]; }
+
+    // Graph i as a regular Graph (same vertices, edges and weights).
+    Graph graph(std::size_t i) const;
+
+    // True when `id` has a mask kernel (otherwise run() uses the fallback).
+    static bool hasKernel(AlgorithmId id) noexcept;
+
+    // Reply of `id` (default options) for every graph, in batch order.
+    std::vector<std::string> run(AlgorithmId id, unsigned maxThreads = 0) const;
+
+    // Drop every graph but keep the arena's capacity for the next batch.
+    void clear() noexcept;
+
+private:
+    struct Entry {
+        std::size_t   row;                    // first row in m_rows
+        std::size_t   arc;                    // first arc in m_arcs
+        std::uint32_t arcs;                   // number of arcs
+        std::uint8_t  n;                      // vertices
+        bool          directed;               // arc semantics
+    };
+
+    std::vector<Entry> m_graphs;              // per-graph header
+    std::vector<Mask>  m_rows;                // all adjacency rows, back to back
+    std::vector<Arc>   m_arcs;                // all weighted arcs, back to back
+};
@@ -0,0 +1,226 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include "algo/Frontier.hpp"              // FrontierGraph (out / in CSR pair)
+#include "algo/Parallel.hpp"              // parallel_for, parallel_slots on the shared pool
+#include "graph/Csr.hpp"                  // row views
+#include "graph/Graph.hpp"                // Graph::Weight entries
+#include <algorithm>                      // std::sort of each bucket's output ids
+#include <cstddef>                        // std::size_t
+#include <cstdint>                        // std::uint8_t mask flags
+#include <limits>                         // semiring identities
+#include <utility>                        // std::pair products
+#include <vector>                         // dense and sparse vectors
+
+// ==========================
+// Sparse linear algebra over the graph's CSR (GraphBLAS-style)
+// ==========================
+// The adjacency matrix A has A(u, v) = w(u, v) for every arc u -> v. The
+// kernels compute y = x·A, i.e. y[v] = ⊕ over arcs u -> v of (A(u, v) ⊗ x[u]),
+// over a semiring (⊕, ⊗):
+// - spmv(A, x, y, mask)    dense x: every v pulls from its in-neighbors
+//                          (rows of A.in); no atomics, one writer per v.
+// - spmspv(A, x, mask)     sparse x: every nonzero u pushes along its
+//                          out-arcs (rows of A.out). The products are
+//                          bucketed by target range, and each bucket is
+//                          reduced by one participant into a dense
+//                          accumulator. The result is sparse, with
+//                          ascending ids. Loops pass an SpmspvWorkspace so
+//                          the accumulator is allocated once and each call
+//                          costs O(nnz(x) + products), not O(n).
+// A mask limits which v are computed at all. The complement form
+// (Mask::skip) is the usual "not yet visited" filter of BFS-like loops.
+//
+// A semiring supplies Value, zero() (identity of ⊕), add (⊕) and
+// multiply(entry, x) (⊗). kWeighted says whether multiply reads the stored
+// arc weight. Pattern semirings (kWeighted = false) treat every entry as 1,
+// so they also run on views without weights (Csr::View::Symmetric).
+// ==========================
+
+namespace semiring {
+
+// (+, ×): weighted sums (e.g. SpMV with a weight matrix).
+template <class T>
+struct PlusTimes {
+    using Value = T;
+    static constexpr bool kWeighted = true;
+    static constexpr T zero() noexcept { return T(0); }
+    static constexpr T add(T a, T b) noexcept { return a + b; }
+    static constexpr T multiply(Graph::Weight w, T x) noexcept { return static_cast<T>(w) * x; }
+};
+
+// (+, second): sums over in-neighbors, entries ignored (PageRank, counting).
+template <class T>
+struct PlusSecond {
+    using Value = T;
+    static constexpr bool kWeighted = false;
+    static constexpr T zero() noexcept { return T(0); }
+    static constexpr T add(T a, T b) noexcept { return a + b; }
+    static constexpr T multiply(Graph::Weight, T x) noexcept { return x; }
+};
+
+// (min, +): one relaxation step of shortest paths. zero() is "unreached"
+// and stays unreached under ⊗ (no overflow past the sentinel).
+template <class T>
+struct MinPlus {
+    using Value = T;
+    static constexpr bool kWeighted = true;
+    static constexpr T zero() noexcept {
+        return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                    : std::numeric_limits<T>::max();
+    }
+    static constexpr T add(T a, T b) noexcept { return b < a ? b : a; }
+    static constexpr T multiply(Graph::Weight w, T x) noexcept { return x == zero() ? x : x + static_cast<T>(w); }
+};
+
+// (min, second): smallest x over in-neighbors (BFS parents, label propagation).
+template <class T>
+struct MinSecond {
+    using Value = T;
+    static constexpr bool kWeighted = false;
+    static constexpr T zero() noexcept { return std::numeric_limits<T>::max(); }
+    static constexpr T add(T a, T b) noexcept { return b < a ? b : a; }
+    static constexpr T multiply(Graph::Weight, T x) noexcept { return x; }
+};
+
+} // namespace semiring
+
+/**
+ * @brief Output mask over the vertices: with flags set, only v whose flag
+ *        is nonzero (keep) or zero (skip) are computed.
+ */
+struct Mask {
+    const std::uint8_t* flags = nullptr;     // nullptr: every v
+    bool complement = false;                 // true: compute where flags[v] == 0
+
+    static Mask keep(const std::vector<std::uint8_t>& f) noexcept { return Mask{ f.data(), false }; }
+    static Mask skip(const std::vector<std::uint8_t>& f) noexcept { return Mask{ f.data(), true }; }
+
+    bool allows(std::size_t v) const noexcept { return !flags || ((flags[v] != 0) != complement); }
+};
+
+/**
+ * @brief Sparse vector: nonzero ids (distinct) with their values.
+ */
+template <class T>
+struct SparseVector {
+    std::size_t              n = 0;          // dimension
+    std::vector<Csr::Index>  ids;            // nonzero positions
+    std::vector<T>           values;         // values[k] belongs to ids[k]
+
+    std::size_t nnz() const noexcept { return ids.size(); }
+};
+
+/**
+ * @brief Dense scratch of spmspv, kept across calls. Sized to n on first
+ *        use; a call resets only the entries it touched before returning.
+ */
+template <class T>
+struct SpmspvWorkspace {
+    std::vector<T>            acc;           // running ⊕ per target
+    std::vector<std::uint8_t> seen;          // target has a product in this call
+};
+
+inline constexpr std::size_t kSpmvGrain = 1024;              // rows per parallel_for chunk
+
+// ---------------- spmv: y = x·A (dense) ----------------
+
+// Rows the mask excludes keep their value in y. y is resized (to zero())
+// when it does not have n entries.
+template <class SR>
+void spmv(const FrontierGraph& A, const std::vector<typename SR::Value>& x,
+          std::vector<typename SR::Value>& y, const Mask& mask = {}, unsigned maxThreads = 0) {
+    using T = typename SR::Value;
+    const std::size_t n = A.n();
+    if (y.size() != n) y.assign(n, SR::zero());
+    const std::size_t*   off = A.in.offsets.data();
+    const Csr::Index*    src = A.in.targets.data();
+    const Graph::Weight* w   = A.in.weights.data();
+    const T*             xv  = x.data();
+    parallel_for(n, kSpmvGrain, [&](std::size_t lo, std::size_t hi, unsigned) {
+        for (std::size_t v = lo; v < hi; ++v) {
+            if (!mask.allows(v)) continue;
+            T acc = SR::zero();
+            for (std::size_t p = off[v], e = off[v + 1]; p < e; ++p) {
+                if constexpr (SR::kWeighted) acc = SR::add(acc, SR::multiply(w[p], xv[src[p]]));
+                else                         acc = SR::add(acc, SR::multiply(1, xv[src[p]]));
+            }
+            y[v] = acc;
+        }
+    }, maxThreads);
+}
+
+// ---------------- spmspv: y = x·A (sparse) ----------------
+
+template <class SR>
+SparseVector<typename SR::Value> spmspv(const FrontierGraph& A, const SparseVector<typename SR::Value>& x,
+                                        SpmspvWorkspace<typename SR::Value>& ws,
+                                        const Mask& mask = {}, unsigned maxThreads = 0) {
+    using T = typename SR::Value;
+    using Product = std::pair<Csr::Index, T>;
+    const std::size_t n = A.n();
+    SparseVector<T> y;
+    y.n = n;
+    if (x.ids.empty() || n == 0) return y;
+
+    // Buckets split the targets into power-of-two ranges, a few per participant.
+    const unsigned slots = parallel_slots(maxThreads);
+    unsigned shift = 0;
+    while ((n >> shift) > 4 * static_cast<std::size_t>(slots)) ++shift;
+    const std::size_t buckets = (n >> shift) + 1;
+
+    // 1) products, per participant and bucket
+    const std::size_t*   off = A.out.offsets.data();
+    const Csr::Index*    dst = A.out.targets.data();
+    const Graph::Weight* w   = A.out.weights.data();
+    std::vector<std::vector<std::vector<Product>>> parts(slots, std::vector<std::vector<Product>>(buckets));
+    parallel_for(x.ids.size(), 64, [&](std::size_t lo, std::size_t hi, unsigned slot) {
+        auto& mine = parts[slot];
+        for (std::size_t k = lo; k < hi; ++k) {
+            const Csr::Index u = x.ids[k];
+            const T xu = x.values[k];
+            for (std::size_t p = off[u], e = off[u + 1]; p < e; ++p) {
+                const Csr::Index v = dst[p];
+                if (!mask.allows(v)) continue;
+                if constexpr (SR::kWeighted) mine[v >> shift].emplace_back(v, SR::multiply(w[p], xu));
+                else                         mine[v >> shift].emplace_back(v, SR::multiply(1, xu));
+            }
+        }
+    }, maxThreads);
+
+    // 2) reduce each bucket into the dense accumulator over its target range
+    if (ws.seen.size() != n) { ws.acc.assign(n, SR::zero()); ws.seen.assign(n, 0); }
+    std::vector<T>& acc = ws.acc;
+    std::vector<std::uint8_t>& seen = ws.seen;
+    std::vector<std::vector<Csr::Index>> outIds(buckets);
+    std::vector<std::vector<T>> outValues(buckets);
+    parallel_for(buckets, 1, [&](std::size_t lo, std::size_t hi, unsigned) {
+        for (std::size_t b = lo; b < hi; ++b) {
+            auto& ids = outIds[b];
+            for (const auto& part : parts)
+                for (const Product& pr : part[b]) {
+                    if (!seen[pr.first]) { seen[pr.first] = 1; acc[pr.first] = pr.second; ids.push_back(pr.first); }
+                    else acc[pr.first] = SR::add(acc[pr.first], pr.second);
+                }
+            std::sort(ids.begin(), ids.end());
+            outValues[b].reserve(ids.size());
+            for (Csr::Index v : ids) { outValues[b].push_back(acc[v]); seen[v] = 0; } // leave ws clean
+        }
+    }, maxThreads);
+
+    std::size_t total = 0;
+    for (const auto& ids : outIds) total += ids.size();
+    y.ids.reserve(total);
+    y.values.reserve(total);
+    for (std::size_t b = 0; b < buckets; ++b) {
+        y.ids.insert(y.ids.end(), outIds[b].begin(), outIds[b].end());
+        y.values.insert(y.values.end(), outValues[b].begin(), outValues[b].end());
+    }
+    return y;
+}
+
+// One-off product: allocates its own O(n) workspace.
+template <class SR>
+SparseVector<typename SR::Value> spmspv(const FrontierGraph& A, const SparseVector<typename SR::Value>& x,
+                                        const Mask& mask = {}, unsigned maxThreads = 0) {
+    SpmspvWorkspace<typename SR::Value> ws;
+    return spmspv<SR>(A, x, ws, mask, maxThreads);
+}
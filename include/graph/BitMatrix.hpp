@@ -0,0 +1,79 @@
+#pragma once                              // ensure this header is included only once per translation unit
+
+#include "graph/Graph.hpp"                // Graph source for the conversion
+#include <cstddef>                        // std::size_t
+#include <cstdint>                        // std::uint64_t words
+#include <cstdlib>                        // std::free for the aligned buffer
+#include <memory>                         // std::unique_ptr owning the buffer
+
+// ==========================
+// Packed adjacency bit matrix
+// ==========================
+// Dense-graph representation: bit v of row u is set iff arc u->v exists
+// (undirected graphs hold both directions, exactly like Graph::adj()).
+// - one contiguous buffer, every row starts on a 64-byte boundary and is
+//   padded to a whole number of 64-byte blocks (8 words);
+// - row kernels (and / or / and-not / popcount) run block by block and are
+//   compiled for AVX2 + POPCNT as well, picked at load time on x86-64;
+// - BitMatrix::of(g) builds the matrix once per graph state and shares it
+//   through the graph's artifact cache.
+// Algorithms switch to it when preferred(g) says the graph is dense enough.
+// ==========================
+
+class BitMatrix {
+public:
+    using Word = std::uint64_t;
+    static constexpr std::size_t kAlign      = 64;                     // bytes per row alignment
+    static constexpr std::size_t kBlockWords = kAlign / sizeof(Word);  // row padding unit (8 words)
+    static constexpr std::size_t npos        = static_cast<std::size_t>(-1);
+
+    BitMatrix() = default;
+
+    // rows x cols zero bits.
+    BitMatrix(std::size_t rows, std::size_t cols);
+
+    BitMatrix(BitMatrix&&) noexcept = default;
+    BitMatrix& operator=(BitMatrix&&) noexcept = default;
+
+    // Adjacency matrix of g (n x n).
+    static BitMatrix fromGraph(const Graph& g);
+
+    // Adjacency matrix of g from its artifact cache (built on first use).
+    static const BitMatrix& of(const Graph& g);
+
+    // True when the matrix is no larger than g's adjacency lists (one row
+    // costs n/8 bytes, one list entry 16) and n is at most kMaxDense.
+    static bool preferred(const Graph& g) noexcept;
+    static constexpr std::size_t kMaxDense = std::size_t(1) << 15;     // 128 MB matrix
+
+    std::size_t rows()  const noexcept { return m_rows; }
+    std::size_t cols()  const noexcept { return m_cols; }
+    std::size_t words() const noexcept { return m_words; }             // words per row (multiple of 8)
+    std::size_t bytes() const noexcept { return m_rows * m_words * sizeof(Word); }
+
+    Word*       row(std::size_t r)       noexcept { return m_bits.get() + r * m_words; }
+    const Word* row(std::size_t r) const noexcept { return m_bits.get() + r * m_words; }
+
+    bool test(std::size_t r, std::size_t c) const noexcept { return (row(r)[c / 64] >> (c % 64)) & 1u; }
+    void set(std::size_t r, std::size_t c)   noexcept { row(r)[c / 64] |=  (Word(1) << (c % 64)); }
+    void reset(std::size_t r, std::size_t c) noexcept { row(r)[c / 64] &= ~(Word(1) << (c % 64)); }
+
+    // Number of set bits in row r (out-degree for an adjacency matrix).
+    std::size_t count(std::size_t r) const noexcept { return popcount(row(r), m_words); }
+
+    // Row kernels over `words` words (a multiple of kBlockWords, 64-byte aligned).
+    static void andRows(Word* dst, const Word* a, const Word* b, std::size_t words) noexcept;
+    static void orRows(Word* dst, const Word* a, const Word* b, std::size_t words) noexcept;
+    static void andNotRows(Word* dst, const Word* a, const Word* b, std::size_t words) noexcept; // a & ~b
+    static std::size_t popcount(const Word* a, std::size_t words) noexcept;
+    static std::size_t andCount(const Word* a, const Word* b, std::size_t words) noexcept;    // |a & b|
+
+    // First set bit at index >= from, or npos.
+    static std::size_t nextSet(const Word* a, std::size_t words, std::size_t from) noexcept;
+
+private:
+    struct Free { void operator()(Word* p) const noexcept { std::free(p); } };
+
+    std::size_t m_rows = 0, m_cols = 0, m_words = 0;
+    std::unique_ptr<Word[], Free> m_bits;   // rows * words, 64-byte aligned
+};
@@ -0,0 +1,53 @@
+#pragma once                              // ensure this header is included only once per translation unit
+
+#include "graph/Graph.hpp"                // Graph source for the conversion
+#include "sys/BigAlloc.hpp"               // huge-page backed arrays
+#include <cstddef>                        // std::size_t
+#include <cstdint>                        // std::uint32_t compact vertex ids
+
+// ==========================
+// Compressed Sparse Row view
+// ==========================
+// A frozen, flat copy of a Graph's adjacency for traversal-heavy kernels:
+// - offsets[u] .. offsets[u+1] index the neighbors of u in `targets`
+// - targets use 32-bit ids to halve the bytes streamed per edge
+// - weights[i] is the weight of arc (u, targets[i])
+// - large arrays are 2 MiB aligned and huge-page backed (sys/BigAlloc.hpp)
+// Undirected graphs keep both directions, exactly like Graph::adj().
+// Csr::of() returns a view shared through the graph's artifact cache.
+// ==========================
+
+struct Csr {
+    using Index = std::uint32_t;          // compact vertex id stored per edge
+
+    BigArray<std::size_t>   offsets;      // n+1 row starts
+    BigArray<Index>         targets;      // neighbor per arc
+    BigArray<Graph::Weight> weights;      // weight per arc
+
+    // Number of vertices.
+    std::size_t n() const noexcept { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    // Number of stored arcs (2*m for undirected graphs).
+    std::size_t arcs() const noexcept { return targets.size(); }
+
+    // Number of arcs leaving u.
+    std::size_t degree(std::size_t u) const { return offsets[u + 1] - offsets[u]; }
+
+    // Out-neighbors of every vertex (same order as Graph::adj()).
+    static Csr fromGraph(const Graph& g);
+
+    // In-neighbors of every vertex, i.e. the CSR of g.reversed(), built
+    // directly without materialising the reversed Graph.
+    static Csr transposeOf(const Graph& g);
+
+    // Neighbors ignoring direction: fromGraph() for undirected graphs; for
+    // directed graphs the union of in- and out-neighbors, sorted and
+    // deduplicated (weights are not carried and stay empty).
+    static Csr symmetricOf(const Graph& g);
+
+    // Which of the builders above a cached view comes from.
+    enum class View { Out, In, Symmetric };
+
+    // The requested view of g from its artifact cache (built on first use).
+    static const Csr& of(const Graph& g, View view = View::Out);
+};
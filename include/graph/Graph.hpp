@@ -6,6 +6,8 @@
 #include <stdexcept>     // defines exceptions like out_of_range, invalid_argument
 #include <algorithm>     // used for std::any_of and std::find_if
 #include <string>        // used for std::string in label()
+#include <memory>        // used for the shared artifact cache
+#include "graph/GraphCache.hpp" // lazily built derived views
 
 // ==========================
 // Minimal, future-proof Graph
@@ -13,9 +15,12 @@
 // This class supports:
 // - Directed and undirected graphs
 // - Weights on edges (for MST, Max-Flow, etc.)
+// - Optional per-edge cost as a second attribute (min-cost flow)
 // - Const adjacency access (for Euler, Hamilton, SCC algorithms)
 // - reversed() builder (for SCC and flow algorithms)
 // - Guards against self-loops and multi-edges (for simple graphs)
+// - A cache of derived views (degree arrays, reversed view, CSR, ...),
+//   shared by all algorithms and copies while the graph is unchanged
 // ==========================
 
 class Graph {
@@ -38,11 +43,32 @@ public:
 
     // Primary constructor taking explicit Options
     explicit Graph(std::size_t n, Kind kind, Options opts)
-        : m_kind(kind), m_opts(opts), m_adj(n), m_edgesLogical(0) {}
+        : m_kind(kind), m_opts(opts), m_adj(n), m_edgesLogical(0),
+          m_cache(std::make_shared<GraphCache>()) {}
 
     // Convenience constructor: uses default Options{}
     explicit Graph(std::size_t n = 0, Kind kind = Kind::Undirected)
-        : m_kind(kind), m_opts(Options{}), m_adj(n), m_edgesLogical(0) {}
+        : m_kind(kind), m_opts(Options{}), m_adj(n), m_edgesLogical(0),
+          m_cache(std::make_shared<GraphCache>()) {}
+
+    // Copies share the cache until either side changes. A moved-from graph is
+    // left empty with a fresh cache of its own, so cache() is always valid.
+    Graph(const Graph&) = default;
+    Graph& operator=(const Graph&) = default;
+    Graph(Graph&& other) : Graph(std::move(other), std::make_shared<GraphCache>()) {}
+    Graph& operator=(Graph&& other) {
+        if (this == &other) return *this;
+        auto fresh = std::make_shared<GraphCache>();    // may throw: nothing moved yet
+        m_kind = other.m_kind;
+        m_opts = other.m_opts;
+        m_adj  = std::move(other.m_adj);
+        m_cost = std::move(other.m_cost);
+        m_edgesLogical = std::exchange(other.m_edgesLogical, 0);
+        m_cache = std::exchange(other.m_cache, std::move(fresh));
+        other.m_adj.clear();
+        other.m_cost.clear();
+        return *this;
+    }
 
     // ---- Public API ----
 
@@ -66,44 +92,38 @@ public:
 
     // Add edge u->v with optional weight w (default = 1)
     void addEdge(Vertex u, Vertex v, Weight w = 1) {
-        checkIndex(u);
-        checkIndex(v);
-
-        if (!m_opts.allowSelfLoops && u == v) {
-            throw std::invalid_argument("self-loops are disabled in this graph");
-        }
+        insertEdge(u, v, w, 0);
+    }
 
-        if (!m_opts.allowMultiEdges) {
-            if (hasArc(u, v)) return;
-            if (!directed() && hasArc(v, u)) return;
+    // Add edge u->v with weight (capacity) w and a second attribute, its cost.
+    // Costs live in their own arrays parallel to adj(); graphs that never
+    // set one keep those arrays empty.
+    void addEdge(Vertex u, Vertex v, Weight w, Weight cost) {
+        if (cost != 0 && !hasCosts()) {                        // first real cost: materialize zeros
+            m_cost.resize(n());
+            for (Vertex x = 0; x < n(); ++x) m_cost[x].assign(m_adj[x].size(), 0);
         }
+        insertEdge(u, v, w, cost);
+    }
 
-        m_adj[u].emplace_back(v, w);
-
-        if (!directed()) {
-            m_adj[v].emplace_back(u, w);
-        }
+    // True once any edge was given a non-zero cost
+    bool hasCosts() const noexcept { return !m_cost.empty(); }
 
-        ++m_edgesLogical;
+    // Cost of the i-th arc in adj(u) (0 when the graph carries no costs)
+    Weight cost(Vertex u, std::size_t i) const {
+        checkIndex(u);
+        if (i >= m_adj[u].size()) throw std::out_of_range("arc index out of range");
+        return hasCosts() ? m_cost[u][i] : 0;
     }
 
     // Remove logical edge between u and v (implemented in Graph.cpp)
     bool removeEdge(Vertex u, Vertex v);
 
-    // Compute out-degree of each vertex
-    std::vector<std::size_t> outDegree() const {
-        std::vector<std::size_t> d(n());
-        for (Vertex u = 0; u < n(); ++u) d[u] = m_adj[u].size();
-        return d;
-    }
+    // Out-degree of each vertex (computed once per graph state, implemented in Graph.cpp)
+    const std::vector<std::size_t>& outDegree() const;
 
-    // Compute in-degree of each vertex
-    std::vector<std::size_t> inDegree() const {
-        std::vector<std::size_t> d(n(), 0);
-        for (Vertex u = 0; u < n(); ++u)
-            for (const auto& e : m_adj[u]) ++d[e.first];
-        return d;
-    }
+    // In-degree of each vertex (computed once per graph state, implemented in Graph.cpp)
+    const std::vector<std::size_t>& inDegree() const;
 
     // Compute degree (only for undirected graphs)
     std::vector<std::size_t> degree() const {
@@ -123,9 +143,15 @@ public:
                            [v](const Edge& e){ return e.first == v; });
     }
 
+    // Artifacts derived from the current edges (built lazily, thread-safe)
+    GraphCache& cache() const noexcept { return *m_cache; }
+
     // Build and return a reversed graph (implemented in Graph.cpp)
     Graph reversed() const;
 
+    // Shared, read-only reversed graph from the artifact cache (implemented in Graph.cpp)
+    const Graph& reversedView() const;
+
     // Return a human-readable summary of the graph (implemented in Graph.cpp)
     std::string label() const;
 
@@ -133,7 +159,9 @@ private:
     Kind m_kind;                               // directed or undirected
     Options m_opts;                            // options (loops, multi-edges)
     std::vector<std::vector<Edge>> m_adj;      // adjacency list
+    std::vector<std::vector<Weight>> m_cost;   // per-arc cost parallel to m_adj (empty = all zero)
     std::size_t m_edgesLogical;                // number of logical edges
+    std::shared_ptr<GraphCache> m_cache;       // derived views; shared by copies until either changes
 
     // Helper: check if vertex index is valid
     void checkIndex(Vertex u) const {
@@ -141,12 +169,54 @@ private:
             throw std::out_of_range("vertex index out of range");
     }
 
+    // Helper: drop cached artifacts before the edges change. A cache that is
+    // empty and not shared with a copy can simply be kept.
+    void invalidate() {
+        if (m_cache.use_count() > 1 || m_cache->used()) m_cache = std::make_shared<GraphCache>();
+    }
+
+    // Helper: move constructor body; `fresh` is allocated before anything moves
+    Graph(Graph&& other, std::shared_ptr<GraphCache> fresh) noexcept
+        : m_kind(other.m_kind), m_opts(other.m_opts), m_adj(std::move(other.m_adj)),
+          m_cost(std::move(other.m_cost)), m_edgesLogical(std::exchange(other.m_edgesLogical, 0)),
+          m_cache(std::exchange(other.m_cache, std::move(fresh))) {
+        other.m_adj.clear();
+        other.m_cost.clear();
+    }
+
+    // Helper: shared body of both addEdge overloads
+    void insertEdge(Vertex u, Vertex v, Weight w, Weight cost) {
+        checkIndex(u);
+        checkIndex(v);
+
+        if (!m_opts.allowSelfLoops && u == v) {
+            throw std::invalid_argument("self-loops are disabled in this graph");
+        }
+
+        if (!m_opts.allowMultiEdges) {
+            if (hasArc(u, v)) return;
+            if (!directed() && hasArc(v, u)) return;
+        }
+
+        invalidate();
+        m_adj[u].emplace_back(v, w);
+        if (hasCosts()) m_cost[u].push_back(cost);
+
+        if (!directed()) {
+            m_adj[v].emplace_back(u, w);
+            if (hasCosts()) m_cost[v].push_back(cost);
+        }
+
+        ++m_edgesLogical;
+    }
+
     // Helper: remove arc u->v from adjacency list of u
     bool removeOneArc(Vertex u, Vertex v) {
         auto& lst = m_adj[u];
         auto it = std::find_if(lst.begin(), lst.end(),
                                [v](const Edge& e){ return e.first == v; });
         if (it != lst.end()) {
+            if (hasCosts()) m_cost[u].erase(m_cost[u].begin() + (it - lst.begin()));
             lst.erase(it);
             return true;
         }
@@ -0,0 +1,60 @@
+#pragma once                              // ensure this header is included only once per translation unit
+
+#include <array>                          // one entry per artifact kind
+#include <atomic>                         // "anything built yet" flag
+#include <cstddef>                        // std::size_t
+#include <memory>                         // type-erased shared ownership
+#include <mutex>                          // std::once_flag / std::call_once
+
+// ==========================
+// Per-graph artifact cache
+// ==========================
+// Derived views of a Graph (degrees, reversed graph, CSR views, packed
+// adjacency matrix, component labels) are built on first request and then
+// shared by every algorithm that reads the same, unmodified graph - also
+// across threads: each slot is guarded by its own std::once_flag, so
+// concurrent first requests build it exactly once and everyone else waits
+// for that result.
+// The Graph owns its cache through a shared_ptr and swaps in a fresh one
+// whenever it is modified, so an artifact never outlives the graph state it
+// was built from. References returned by get() stay valid until then.
+// ==========================
+
+class GraphCache {
+public:
+    // Artifact kinds; each has its own slot.
+    enum class Slot : unsigned {
+        OutDegree,                        // Graph::outDegree()
+        InDegree,                         // Graph::inDegree()
+        Reversed,                         // Graph::reversedView()
+        CsrOut,                           // Csr::of(g, Csr::View::Out)
+        CsrIn,                            // Csr::of(g, Csr::View::In)
+        CsrSymmetric,                     // Csr::of(g, Csr::View::Symmetric)
+        BitMatrix,                        // graph/BitMatrix.hpp
+        Components,                       // StrongComponents::of(g)
+        Count
+    };
+
+    // Return the artifact in `slot`, building it with build() on first use.
+    // T must be the type build() returns; one slot always holds one type.
+    template <class T, class Build>
+    const T& get(Slot slot, Build&& build) {
+        Entry& e = m_slots[static_cast<std::size_t>(slot)];
+        std::call_once(e.once, [&]{
+            e.value = std::make_shared<const T>(build());
+            m_used.store(true, std::memory_order_release);
+        });
+        return *static_cast<const T*>(e.value.get());
+    }
+
+    // True once any artifact has been built.
+    bool used() const noexcept { return m_used.load(std::memory_order_acquire); }
+
+private:
+    struct Entry {
+        std::once_flag once;                    // first builder wins
+        std::shared_ptr<const void> value;      // built artifact (type fixed per slot)
+    };
+    std::array<Entry, static_cast<std::size_t>(Slot::Count)> m_slots;
+    std::atomic<bool> m_used{false};
+};
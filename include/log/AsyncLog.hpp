@@ -0,0 +1,193 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include <atomic>                         // ring indices, level, counters
+#include <chrono>                         // steady_clock timestamps
+#include <cstddef>                        // std::size_t
+#include <cstdint>                        // fixed-width record fields
+#include <cstdio>                         // std::FILE sink
+#include <cstring>                        // std::memcpy for string arguments
+#include <string>                         // std::string arguments
+#include <string_view>                    // std::string_view arguments
+#include <type_traits>                    // integral / enum argument dispatch
+
+// ==========================
+// Asynchronous structured logger
+// ==========================
+// A log call does no formatting and no I/O. It checks the level, then packs
+// a fixed-size binary record (timestamp, static format string, integer
+// arguments, copied string arguments) into the calling thread's own
+// single-producer ring. A background thread drains every ring, orders the
+// records by timestamp, expands the "{}" placeholders and writes the lines
+// to the sink in one fwrite per round. A full ring drops the record and
+// counts it, so a hot thread never blocks. The drainer reports drops and
+// rate-limited records.
+// ==========================
+
+enum class LogLevel : std::uint8_t { Debug, Info, Warn, Error, Off };
+
+/**
+ * @brief One log call as it sits in a ring: 256 bytes, no pointers into the
+ *        caller's memory except the format string (which must be a literal).
+ */
+struct LogRecord {
+    static constexpr std::size_t kMaxArgs  = 6;     // "{}" arguments per call
+    static constexpr std::size_t kTextSize = 184;   // bytes for all string arguments
+
+    enum ArgKind : std::uint8_t { Int, Uint, Str, StrCut }; // StrCut = truncated string
+
+    std::uint64_t ns;                     // steady_clock time of the call
+    const char*   fmt;                    // static format string with {} placeholders
+    std::int64_t  args[kMaxArgs];         // integer values (bit pattern for Uint)
+    std::uint8_t  kinds[kMaxArgs];        // how to print args[i] (strings live in text)
+    std::uint8_t  nargs;                  // arguments used
+    LogLevel      level;                  // severity
+    char          text[kTextSize];        // string arguments, NUL-separated
+};
+static_assert(sizeof(LogRecord) == 256, "LogRecord should stay four cache lines");
+
+/**
+ * @brief Lock-free single-producer/single-consumer ring owned by one thread.
+ *        The producer only advances head, the drainer only advances tail.
+ */
+struct LogRing {
+    static constexpr std::size_t kCapacity = 1024;  // records per thread (power of two)
+
+    alignas(64) std::atomic<std::uint64_t> head{0};       // next slot to write (producer)
+    alignas(64) std::atomic<std::uint64_t> tail{0};       // next slot to read (drainer)
+    alignas(64) std::atomic<std::uint64_t> dropped{0};    // records lost to a full ring
+    std::atomic<std::uint64_t>             suppressed{0}; // records skipped by rate limits
+    std::atomic<bool>                      retired{false};// owning thread has exited
+    LogRecord slots[kCapacity];                            // the ring itself
+};
+
+class AsyncLog {
+public:
+    struct Stats {
+        std::uint64_t written    = 0;     // records formatted and written
+        std::uint64_t dropped    = 0;     // records lost to full rings
+        std::uint64_t suppressed = 0;     // records skipped by rate limits
+    };
+
+    // Minimum level that is recorded (default Info).
+    static void setLevel(LogLevel level) noexcept { s_level.store(level, std::memory_order_relaxed); }
+    static bool enabled(LogLevel level) noexcept { return level >= s_level.load(std::memory_order_relaxed); }
+
+    // Where drained lines go (default stdout). The logger does not own the stream.
+    static void setSink(std::FILE* sink);
+
+    // Record one call. Arguments may be integers, enums, bools, or strings
+    // (const char*, std::string, std::string_view); strings are copied and
+    // truncated to fit the record; a null const char* logs as "(null)".
+    // `fmt` must outlive the logger (a literal).
+    template <typename... Args>
+    static void write(LogLevel level, const char* fmt, const Args&... args) {
+        static_assert(sizeof...(Args) <= LogRecord::kMaxArgs, "too many log arguments");
+        LogRing& ring = t_ring ? *t_ring : attachThread();          // per-thread ring
+        const std::uint64_t h = ring.head.load(std::memory_order_relaxed);
+        if (h - ring.tail.load(std::memory_order_acquire) == LogRing::kCapacity) { // full: never block
+            ring.dropped.store(ring.dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+        LogRecord& r = ring.slots[h & (LogRing::kCapacity - 1)];
+        r.ns    = (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch()).count();
+        r.fmt   = fmt;
+        r.nargs = 0;
+        r.level = level;
+        std::size_t used = 0;                                        // text bytes used
+        (pack(r, used, args), ...);
+        (void)used;                                                  // no string arguments
+        ring.head.store(h + 1, std::memory_order_release);           // publish
+    }
+
+    // Count a call skipped by LOG_RATE_LIMITED on this thread.
+    static void noteSuppressed() noexcept {
+        LogRing& ring = t_ring ? *t_ring : attachThread();
+        ring.suppressed.store(ring.suppressed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // Block until everything logged before this call has been written.
+    static void flush();
+
+    // Write everything logged so far and stop the drain thread. Records
+    // logged afterwards wait in their rings until the next flush().
+    static void shutdown();
+
+    // Totals since start.
+    static Stats stats();
+
+private:
+    static LogRing& attachThread();       // slow path: create + register this thread's ring
+
+    template <typename T>
+    static void pack(LogRecord& r, std::size_t& used, const T& v) {
+        if constexpr (std::is_same_v<T, bool>) {
+            r.kinds[r.nargs] = LogRecord::Uint; r.args[r.nargs++] = v ? 1 : 0;
+        } else if constexpr (std::is_enum_v<T>) {
+            pack(r, used, static_cast<std::underlying_type_t<T>>(v));
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            r.kinds[r.nargs] = LogRecord::Int;  r.args[r.nargs++] = (std::int64_t)v;
+        } else if constexpr (std::is_integral_v<T>) {
+            r.kinds[r.nargs] = LogRecord::Uint; r.args[r.nargs++] = (std::int64_t)(std::uint64_t)v;
+        } else if constexpr (std::is_pointer_v<T>) {
+            packText(r, used, v ? std::string_view(v) : std::string_view("(null)"));
+        } else {
+            packText(r, used, std::string_view(v));
+        }
+    }
+
+    static void packText(LogRecord& r, std::size_t& used, std::string_view s) noexcept {
+        const std::size_t room = used < LogRecord::kTextSize ? LogRecord::kTextSize - used - 1 : 0;
+        const std::size_t n = s.size() < room ? s.size() : room;    // truncate to fit
+        if (used < LogRecord::kTextSize) {
+            std::memcpy(r.text + used, s.data(), n);
+            r.text[used + n] = '\0';
+            used += n + 1;
+        }
+        r.kinds[r.nargs] = n < s.size() ? LogRecord::StrCut : LogRecord::Str;
+        r.args[r.nargs++] = (std::int64_t)n;                        // stored length
+    }
+
+    static inline std::atomic<LogLevel> s_level{LogLevel::Info};
+    static inline thread_local LogRing* t_ring = nullptr;
+};
+
+/**
+ * @brief Per-call-site budget for LOG_RATE_LIMITED: at most `perSecond`
+ *        records per thread per wall-clock second; the rest are counted.
+ */
+class LogRateLimit {
+public:
+    explicit LogRateLimit(unsigned perSecond) noexcept : m_budget(perSecond) {}
+
+    bool allow() noexcept {
+        const std::int64_t sec = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        if (sec != m_second) { m_second = sec; m_used = 0; }       // new window
+        if (m_used < m_budget) { ++m_used; return true; }
+        AsyncLog::noteSuppressed();
+        return false;
+    }
+
+private:
+    unsigned     m_budget;                // records per second
+    unsigned     m_used = 0;              // records in the current second
+    std::int64_t m_second = -1;           // current window
+};
+
+// Call-site macros: arguments are only evaluated when the level is enabled.
+#define LOG_AT(level, ...) \
+    do { if (AsyncLog::enabled(level)) AsyncLog::write(level, __VA_ARGS__); } while (0)
+#define LOG_DEBUG(...) LOG_AT(LogLevel::Debug, __VA_ARGS__)
+#define LOG_INFO(...)  LOG_AT(LogLevel::Info,  __VA_ARGS__)
+#define LOG_WARN(...)  LOG_AT(LogLevel::Warn,  __VA_ARGS__)
+#define LOG_ERROR(...) LOG_AT(LogLevel::Error, __VA_ARGS__)
+
+// Sampling: record the 1st, (n+1)th, (2n+1)th ... call of this site on each thread.
+#define LOG_EVERY_N(level, n, ...) \
+    do { static thread_local unsigned log_every_n_ = 0; \
+         if (AsyncLog::enabled(level) && log_every_n_++ % (n) == 0) AsyncLog::write(level, __VA_ARGS__); } while (0)
+
+// Rate limiting: at most `perSecond` records per second from this site on each thread.
+#define LOG_RATE_LIMITED(level, perSecond, ...) \
+    do { static thread_local LogRateLimit log_rate_(perSecond); \
+         if (AsyncLog::enabled(level) && log_rate_.allow()) AsyncLog::write(level, __VA_ARGS__); } while (0)
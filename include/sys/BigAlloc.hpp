@@ -0,0 +1,91 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include <cstddef>                        // std::size_t
+#include <cstdint>                        // counters
+#include <new>                            // ::operator new for small blocks
+#include <string>                         // policy specs
+#include <vector>                         // BigArray
+
+// ==========================
+// Huge-page backed storage for large graph arrays
+// ==========================
+// Traversals (SCC, BFS, max-flow) read CSR arrays at random. With 4 KiB
+// pages every few reads is a dTLB miss. One 2 MiB page covers 512 times as
+// much memory per TLB entry.
+//
+// BigAllocator sends blocks of kThreshold bytes or more to mmap, sized and
+// aligned to kHugePage. Smaller blocks use ::operator new as usual. What
+// the mapping gets is decided by the process-wide policy:
+//   off          plain anonymous mapping (the kernel's THP default applies)
+//   thp          madvise(MADV_HUGEPAGE): transparent huge pages (default)
+//   hugetlb      MAP_HUGETLB from the reserved pool (vm.nr_hugepages);
+//                falls back to thp when the pool is empty
+//   ...+prefault MAP_POPULATE: fault every page in at allocation time
+//                instead of during the first traversal
+// The block size alone decides the path, so a policy change never affects
+// how an existing block is released.
+// ==========================
+
+class BigAlloc {
+public:
+    enum class Mode { Off, Thp, HugeTlb };
+
+    struct Policy {
+        Mode mode     = Mode::Thp;        // page backing of big blocks
+        bool prefault = false;            // MAP_POPULATE
+    };
+
+    struct Stats {
+        std::uint64_t blocks    = 0;      // big blocks currently mapped
+        std::uint64_t bytes     = 0;      // bytes currently mapped
+        std::uint64_t hugetlb   = 0;      // blocks ever served from the hugetlb pool
+        std::uint64_t fallbacks = 0;      // hugetlb requests ever fallen back to thp
+    };
+
+    static constexpr std::size_t kHugePage  = std::size_t(2) << 20;  // 2 MiB
+    static constexpr std::size_t kThreshold = kHugePage;             // smaller blocks use operator new
+
+    // Parse "off" | "thp" | "hugetlb", optionally followed by "+prefault".
+    // Throws std::invalid_argument for anything else.
+    static Policy parse(const std::string& spec);
+    static std::string describe(const Policy& p);
+
+    static void   setPolicy(const Policy& p) noexcept;
+    static Policy policy() noexcept;
+    static Stats  stats() noexcept;
+
+    // Map `bytes` (>= kThreshold) under the current policy; throws std::bad_alloc.
+    static void* map(std::size_t bytes);
+    // Release a block returned by map(bytes).
+    static void unmap(void* p, std::size_t bytes) noexcept;
+};
+
+/**
+ * @brief std::allocator replacement that routes big blocks through BigAlloc.
+ */
+template <class T>
+struct BigAllocator {
+    using value_type = T;
+
+    BigAllocator() noexcept = default;
+    template <class U>
+    BigAllocator(const BigAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        const std::size_t bytes = n * sizeof(T);
+        if (bytes >= BigAlloc::kThreshold) return static_cast<T*>(BigAlloc::map(bytes));
+        return static_cast<T*>(::operator new(bytes));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        const std::size_t bytes = n * sizeof(T);
+        if (bytes >= BigAlloc::kThreshold) BigAlloc::unmap(p, bytes);
+        else ::operator delete(p);
+    }
+
+    template <class U> bool operator==(const BigAllocator<U>&) const noexcept { return true; }
+    template <class U> bool operator!=(const BigAllocator<U>&) const noexcept { return false; }
+};
+
+// Vector whose storage moves to huge pages once it is large.
+template <class T>
+using BigArray = std::vector<T, BigAllocator<T>>;
@@ -0,0 +1,125 @@
+#pragma once                              // ensure this header is included only once per translation unit
+#include <cstddef>                        // std::size_t
+#include <string>                         // sysfs paths, placement specs
+#include <string_view>                    // cpu list parsing
+#include <thread>                         // std::thread handles to pin
+#include <vector>                         // cpu / node lists
+
+// ==========================
+// CPU / NUMA topology and thread + memory placement
+// ==========================
+// Topology::system() reads the NUMA nodes and their CPUs from sysfs
+// (/sys/devices/system/node/node*/cpulist), restricted to the CPUs this
+// process may run on. Without sysfs it is one node holding every allowed CPU.
+//
+// CpuPlacement maps the i-th thread of a group (a pool, a pipeline stage)
+// to an affinity set:
+//   none         leave the thread unpinned
+//   compact      i-th CPU in node order (fill node 0, then node 1, ...)
+//   scatter      round-robin over nodes, one CPU each
+//   node:N       any CPU of node N
+//   cpus:LIST    i-th entry of LIST (e.g. cpus:0-3,8)
+//
+// MemoryPlacement moves an existing range of pages (graph arrays) with
+// mbind(MPOL_MF_MOVE):
+//   default      leave pages where first touch put them
+//   local        prefer the node of the calling thread
+//   node:N       prefer node N
+//   interleave   spread pages round-robin over every memory node
+//
+// Both are best-effort: a refusal by the kernel (no NUMA support, seccomp)
+// makes apply()/pin() return false and changes nothing.
+// ==========================
+
+/**
+ * @brief NUMA nodes and the CPUs that belong to them.
+ */
+struct Topology {
+    struct Node {
+        int              id;              // kernel node id
+        std::vector<int> cpus;            // sorted CPU ids (empty for memory-only nodes)
+    };
+
+    std::vector<Node> nodes;              // sorted by id
+
+    // The machine this process runs on (read once, then cached).
+    static const Topology& system();
+
+    // Nodes under `root` (normally "/sys/devices/system"). CPUs outside
+    // `allowed` are dropped unless `allowed` is empty. Falls back to one
+    // node 0 with `allowed` when no node directory can be read.
+    static Topology fromSysfs(const std::string& root, const std::vector<int>& allowed = {});
+
+    // Every CPU, node by node.
+    std::vector<int> cpus() const;
+
+    // Node holding `cpu`, or -1.
+    int nodeOf(int cpu) const;
+
+    // Nodes with at least one CPU.
+    std::size_t cpuNodes() const;
+};
+
+// Parse a kernel CPU list ("0-3,8,10-11"); throws std::invalid_argument.
+std::vector<int> parse_cpu_list(std::string_view text);
+
+// Restrict thread `t` (or the calling thread) to `cpus`; false on failure.
+bool pin_thread(std::thread& t, const std::vector<int>& cpus);
+bool pin_this_thread(const std::vector<int>& cpus);
+
+/**
+ * @brief Pinning policy for a group of threads (see the table above).
+ */
+class CpuPlacement {
+public:
+    enum class Kind { None, Compact, Scatter, Node, List };
+
+    CpuPlacement() = default;             // none
+
+    // Parse a spec; throws std::invalid_argument for unknown ones.
+    static CpuPlacement parse(const std::string& spec);
+
+    Kind kind() const noexcept { return m_kind; }
+    std::string describe() const;
+
+    // Affinity set of the index-th thread of the group (empty = unpinned).
+    std::vector<int> cpusFor(unsigned index, const Topology& topo = Topology::system()) const;
+
+    // Pin `t` (or the calling thread) as the index-th thread of the group.
+    // Returns true when nothing had to be done or the pinning succeeded.
+    bool pin(std::thread& t, unsigned index, const Topology& topo = Topology::system()) const;
+    bool pinThis(unsigned index, const Topology& topo = Topology::system()) const;
+
+private:
+    Kind             m_kind = Kind::None;
+    int              m_node = -1;         // node:N
+    std::vector<int> m_list;              // cpus:LIST
+};
+
+/**
+ * @brief Where the pages of large shared arrays should live.
+ */
+class MemoryPlacement {
+public:
+    enum class Kind { Default, Local, Node, Interleave };
+
+    MemoryPlacement() = default;          // default
+
+    // Parse a spec; throws std::invalid_argument for unknown ones.
+    static MemoryPlacement parse(const std::string& spec);
+
+    Kind kind() const noexcept { return m_kind; }
+    std::string describe() const;
+
+    // Move the pages covering [p, p + bytes). True when nothing had to be
+    // done or the kernel accepted the policy.
+    bool apply(const void* p, std::size_t bytes, const Topology& topo = Topology::system()) const;
+
+    // Policy applied to cached graph views (Csr::of) when they are built.
+    static void setGraphs(const MemoryPlacement& policy);
+    static MemoryPlacement graphs();
+
+private:
+    Kind m_kind = Kind::Default;
+    int  m_node = -1;                     // node:N
+};
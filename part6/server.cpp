@@ -9,6 +9,7 @@
 
 #include "graph/Graph.hpp"            // Graph class from your project
 #include "algo/Euler.hpp"             // Euler algorithm from your project
+#include "log/AsyncLog.hpp"           // LOG_INFO (asynchronous, off the event loop)
 
 #include <arpa/inet.h>                // htons, inet_ntop, etc.
 #include <netdb.h>                    // getaddrinfo/freeaddrinfo
@@ -17,8 +18,8 @@
 #include <unistd.h>                   // close()
 #include <csignal>                    // std::signal
 #include <cerrno>                     // errno
+#include <cstdio>                     // std::perror
 #include <cstring>                    // std::memset, std::strerror
-#include <iostream>                   // std::cout, std::cerr
 #include <sstream>                    // std::istringstream, std::ostringstream
 #include <string>                     // std::string
 #include <vector>                     // std::vector
@@ -44,11 +45,11 @@ static void close_all() {
     g_fds.clear();                     // empty the vector
 }
 
-// SIGINT (Ctrl+C) handler — shut down cleanly.
+// SIGINT (Ctrl+C) handler — only sets a flag; the event loop sees poll() fail with
+// EINTR, logs, closes the sockets and flushes the logger.
+static volatile std::sig_atomic_t g_stop = 0;
 static void handle_sigint(int) {
-    std::cout << "\n[server] SIGINT: shutting down…" << std::endl; // friendly log
-    close_all();                         // close all sockets
-    std::_Exit(0);                       // exit immediately without unwinding
+    g_stop = 1;                          // async-signal-safe
 }
 
 // Build a random graph with exactly E unique edges/arcs (no self-loops).
@@ -151,7 +152,7 @@ static void accept_client(int listen_fd) {
     int cfd = ::accept(listen_fd, (sockaddr*)&addr, &alen); // accept()
     if (cfd < 0) { std::perror("accept"); return; }         // log error
     g_fds.push_back({cfd, POLLIN, 0});  // watch it for readability
-    std::cout << "[server] client fd=" << cfd << " connected\n"; // log
+    LOG_INFO("[server] client fd={} connected", cfd); // log
 }
 
 // Handle one line command from a client socket.
@@ -160,7 +161,7 @@ static void handle_command(int cfd, const std::string& line) {
     std::string cmd;                    // first word: command
     iss >> cmd;                         // read it
     if (cmd == "QUIT") {                // client asks to close
-        std::cout << "[server] client fd=" << cfd << " quit\n"; // log
+        LOG_INFO("[server] client fd={} quit", cfd); // log
         ::shutdown(cfd, SHUT_RDWR);     // shutdown both ways
         ::close(cfd);                   // close fd
         // mark in g_fds later; we set POLLIN=0 to drop it
@@ -201,7 +202,7 @@ static void read_from_client(int idx) {
     char buf[kBufSize];                 // buffer for recv
     ssize_t n = ::recv(p.fd, buf, sizeof(buf)-1, 0); // read bytes
     if (n <= 0) {                       // <=0: disconnect or error
-        std::cout << "[server] client fd=" << p.fd << " disconnected\n"; // log
+        LOG_INFO("[server] client fd={} disconnected", p.fd); // log
         ::close(p.fd);                  // close socket
         p.fd = -1; p.events = 0; p.revents = 0; // mark as dead
         return;                         // done
@@ -211,7 +212,7 @@ static void read_from_client(int idx) {
     // trim trailing CR/LF:
     while (!line.empty() && (line.back()=='\n' || line.back()=='\r'))
         line.pop_back();                // drop newline chars
-    std::cout << "[server] fd=" << p.fd << " cmd: " << line << "\n"; // log received command
+    LOG_INFO("[server] fd={} cmd: {}", p.fd, line); // log received command (long lines truncated)
     handle_command(p.fd, line);         // parse + execute command
 }
 
@@ -246,9 +247,9 @@ int main() {
     freeaddrinfo(res);                  // free address info (no longer needed)
 
     g_fds.push_back({sfd, POLLIN, 0});  // watch server socket for new clients
-    std::cout << "[server] listening on " << kIP << ":" << kPort << "\n"; // info
+    LOG_INFO("[server] listening on {}:{}", kIP, kPort); // info
 
-    while (true) {                      // main event loop
+    while (!g_stop) {                   // main event loop (until Ctrl+C)
         int nready = ::poll(g_fds.data(), g_fds.size(), kNoTimeout); // wait for events
         if (nready < 0) {               // poll error
             if (errno == EINTR) continue; // interrupted by signal → continue
@@ -273,6 +274,8 @@ int main() {
                      g_fds.end());       // erase them
     }
 
+    if (g_stop) LOG_INFO("[server] SIGINT: shutting down…"); // friendly log
     close_all();                         // ensure sockets are closed
+    AsyncLog::shutdown();                // write pending log lines
     return 0;                            // done
 }
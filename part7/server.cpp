@@ -2,11 +2,14 @@
 // TCP server using poll(); accepts one-line algorithm requests:
 //   ALG <MST|SCC|MAXFLOW|HAMILTON> RANDOM <V> <E> <SEED> [--directed]
 //   ALG <MST|SCC|MAXFLOW|HAMILTON> MANUAL <V> : u-v u-v ... [--directed]
+//   BATCH <ALG|ALL> : <V> u-v u-v ... [--directed] ; <V> ... ; ...
 // Replies with a human-readable result string from the chosen strategy.
 // =============================================================
 
 #include "../include/graph/Graph.hpp"                    // Graph from your project
 #include "../include/algo/GraphAlgorithm.hpp"      // IGraphAlgorithm interface
+#include "../include/algo/SmallGraphBatch.hpp"     // many tiny graphs in one request
+#include "../include/log/AsyncLog.hpp"            // LOG_INFO (asynchronous, off the event loop)
 // We include the factory & strategy implementations by linking AlgorithmFactory.cpp
 // (either compile it into an object or list it in your Makefile).
 
@@ -19,11 +22,15 @@
 #include <algorithm>                          // remove_if, minmax
 #include <cctype>                             // std::tolower
 #include <csignal>                            // std::signal
-#include <iostream>                           // std::cout, std::cerr
+#include <cstdio>                             // perror
+#include <cstdlib>                            // std::strtoll for the batch parser
 #include <random>                             // std::mt19937
 #include <set>                                // std::set
 #include <sstream>                            // std::(i/o)stringstream
+#include <stdexcept>                          // std::exception from stoll
 #include <string>                             // std::string
+#include <string_view>                        // batch scanner
+#include <unordered_map>                      // per-client input buffers
 #include <vector>                             // std::vector
 
 // ---------- simple config ----------
@@ -32,9 +39,11 @@ static constexpr const char* kPort      = "5555";      // TCP port (string)
 static constexpr int         kBacklog   = 16;          // listen backlog
 static constexpr int         kBufSize   = 4096;        // I/O buffer size
 static constexpr int         kNoTimeout = -1;          // poll timeout (-1 = infinite)
+static constexpr std::size_t kMaxBatchBytes = 16u << 20; // cap on one BATCH line (16 MiB)
 
 // Keep active sockets here; index 0 is the listening socket.
 static std::vector<pollfd> g_fds;                      // global so signal handler can close
+static std::unordered_map<int, std::string> g_pending; // per client fd: input not yet a full line
 
 // --------- tiny helpers ---------
 static std::string lower(std::string s){               // lower-case helper
@@ -48,11 +57,11 @@ static void send_all(int fd, const std::string& s) {   // send entire string (be
 static void close_all() {                               // close all tracked fds
     for (auto& p : g_fds) if (p.fd != -1) ::close(p.fd);
     g_fds.clear();
+    g_pending.clear();
 }
-static void on_sigint(int){                             // SIGINT handler
-    std::cout << "\n[server] SIGINT -> shutdown\n";
-    close_all();
-    std::_Exit(0);
+static volatile std::sig_atomic_t g_stop = 0;           // set by SIGINT, checked by the loop
+static void on_sigint(int){                             // SIGINT handler (async-signal-safe)
+    g_stop = 1;                                         // poll() fails with EINTR; main shuts down
 }
 
 // ---------- Build a random graph with E unique edges (no self-loops). ----------
@@ -84,6 +93,7 @@ static Graph make_random_graph(std::size_t V, std::size_t E, unsigned seed, bool
 
 // ---------- Parse a MANUAL line into a Graph. Format:
 // ALG <name> MANUAL <V> : u-v u-v ... [--directed] ----------
+// An edge token may carry "u-v:cap" or "u-v:cap:cost" (default 1 and 0).
 
 static bool parse_manual_line(const std::string& line, Graph& out, std::string& err) {
     std::istringstream iss(line);                                // tokenize line
@@ -115,6 +125,16 @@ static bool parse_manual_line(const std::string& line, Graph& out, std::string&
         if (dash == std::string::npos) { err = "Bad token: " + s; return false; }       // must have '-'
         int u = std::stoi(s.substr(0, dash));                     // parse u
         int v = std::stoi(s.substr(dash + 1));                    // parse v
+        long long cap = 1, cost = 0;                              // optional ":cap[:cost]" suffix
+        auto c1 = s.find(':', dash);                              // capacity separator
+        if (c1 != std::string::npos) {
+            auto c2 = s.find(':', c1 + 1);                        // cost separator
+            try {
+                cap = std::stoll(s.substr(c1 + 1, c2 == std::string::npos ? std::string::npos : c2 - c1 - 1));
+                if (c2 != std::string::npos) cost = std::stoll(s.substr(c2 + 1));
+            } catch (const std::exception&) { err = "Bad capacity/cost in token: " + s; return false; }
+            if (cap < 0) { err = "Bad capacity/cost in token: " + s; return false; }
+        }
         if (u < 0 || v < 0 || (std::size_t)u >= V || (std::size_t)v >= V || u == v) {   // bounds check
             err = "Invalid endpoints in token: " + s; return false;                     // fail
         }
@@ -122,12 +142,12 @@ static bool parse_manual_line(const std::string& line, Graph& out, std::string&
             auto key = std::make_pair(u, v);                      // ordered arc
             if (seen.count(key)) { err = "Duplicate arc: " + s; return false; }         // dup
             seen.insert(key);                                     // remember
-            out.addEdge(u, v, 1);                                 // add arc
+            out.addEdge(u, v, cap, cost);                         // add arc
         } else {                                                  // undirected
             auto mm = std::minmax(u, v);                          // canonical pair
             if (seen.count(mm)) { err = "Duplicate edge: " + s; return false; }         // dup
             seen.insert(mm);                                      // remember
-            out.addEdge(u, v, 1);                                 // add edge
+            out.addEdge(u, v, cap, cost);                         // add edge
         }
     }
     return true;                                                  // success
@@ -143,15 +163,98 @@ static std::string run_and_format(const std::string& name, const Graph& g) {
     return oss.str();                                              // done
 }
 
+// ---------- Parse a BATCH body into the small-graph arena. Format:
+// <V> u-v u-v ... [--directed] ; <V> ... ; ...   (u-v:w sets a weight, default 1)
+// Hand-rolled scanner: thousands of graphs per line must not cost a stream each.
+static bool parse_batch_body(const char* p, const char* end, SmallGraphBatch& out, std::string& err) {
+    auto skip_ws = [&]{ while (p < end && std::isspace((unsigned char)*p)) ++p; };
+    auto number  = [&](long long& x) {                            // unsigned decimal
+        if (p == end || !std::isdigit((unsigned char)*p)) return false;
+        char* q = nullptr; x = std::strtoll(p, &q, 10); p = q; return true;
+    };
+    for (;;) {
+        skip_ws();
+        if (p == end) break;                                      // trailing ';' is fine
+        const char* start = p;                                    // graph text for error messages
+        long long V = 0;
+        if (!number(V) || V < 1 || V > (long long)SmallGraphBatch::kMaxVertices) {
+            err = "Each batch graph starts with V in 1..64"; return false;
+        }
+        const char* stop = p;                                     // find this graph's end
+        while (stop < end && *stop != ';') ++stop;
+        const std::string_view rest(p, stop - p);
+        const bool directed = rest.find("--directed") != std::string_view::npos;
+        out.addGraph((std::size_t)V, directed);
+        for (;;) {
+            skip_ws();
+            if (p >= stop) break;
+            const std::string_view flag = "--directed";
+            if (std::string_view(p, stop - p).substr(0, flag.size()) == flag) { p += flag.size(); continue; }
+            long long u = 0, v = 0, w = 1;
+            if (!number(u) || p == stop || *p++ != '-' || !number(v) ||
+                (p < stop && *p == ':' && (++p, !number(w)))) {
+                err = "Bad edge in batch graph: " + std::string(start, stop - start); return false;
+            }
+            if (!out.addEdge((std::size_t)u, (std::size_t)v, w)) {
+                err = "Invalid or duplicate edge in batch graph: " + std::string(start, stop - start);
+                return false;
+            }
+        }
+        p = stop < end ? stop + 1 : stop;                         // past ';'
+    }
+    if (out.size() == 0) { err = "Empty batch"; return false; }
+    return true;
+}
+
+// ---------- Run one algorithm (or ALL four) over a batch; one reply for all graphs ----------
+static std::string run_batch(const std::string& line) {
+    std::istringstream iss(line);                                 // header only: BATCH <ALG|ALL> :
+    std::string kw, name; iss >> kw >> name;
+    const auto colon = line.find(':');
+    if (name.empty() || colon == std::string::npos)
+        return "Error: Format: BATCH <ALG|ALL> : <V> u-v ... [--directed] ; <V> ...\n";
+
+    std::vector<AlgorithmId> ids;                                 // parsed once for the whole batch
+    if (lower(name) == "all") ids = { AlgorithmId::Mst, AlgorithmId::Scc, AlgorithmId::MaxFlow, AlgorithmId::Hamilton };
+    else {
+        AlgorithmId id;
+        if (!AlgorithmFactory::parseId(name, id)) return "Unknown algorithm.\n";
+        ids.push_back(id);
+    }
+
+    static thread_local SmallGraphBatch batch;                    // arena reused across requests
+    batch.clear();
+    std::string err;
+    if (!parse_batch_body(line.data() + colon + 1, line.data() + line.size(), batch, err))
+        return "Error: " + err + "\n";
+
+    std::vector<std::vector<std::string>> results;                // [algorithm][graph]
+    for (auto id : ids) results.push_back(batch.run(id));
+
+    std::string out = "Batch: " + std::to_string(batch.size()) + " graphs\n";
+    for (std::size_t i = 0; i < batch.size(); ++i)
+        for (std::size_t a = 0; a < ids.size(); ++a) {
+            out += '#'; out += std::to_string(i);
+            if (ids.size() > 1) { out += ' '; out += AlgorithmFactory::name(ids[a]); }
+            out += ": "; out += results[a][i]; out += '\n';
+        }
+    return out;
+}
+
 // ---------- Command handler: parses one line request ----------
 static void handle_command(int cfd, const std::string& line) {
     std::istringstream iss(line);                                 // tokenize
     std::string kw; iss >> kw;                                    // first word
+    if (lower(kw) == "batch") {                                   // many small graphs, one reply
+        send_all(cfd, run_batch(line));
+        return;
+    }
     if (lower(kw) != "alg") {                                     // must start with ALG
         send_all(cfd,
             "Unknown. Use:\n"
             "  ALG <MST|SCC|MAXFLOW|HAMILTON> RANDOM <V> <E> <SEED> [--directed]\n"
-            "  ALG <MST|SCC|MAXFLOW|HAMILTON> MANUAL <V> : u-v u-v ... [--directed]\n");
+            "  ALG <MST|SCC|MAXFLOW|HAMILTON> MANUAL <V> : u-v u-v ... [--directed]\n"
+            "  BATCH <ALG|ALL> : <V> u-v u-v ... [--directed] ; <V> ... ; ...\n");
         return;                                                    // bail
     }
 
@@ -184,25 +287,54 @@ static void accept_client(int sfd) {
     int cfd = ::accept(sfd, (sockaddr*)&a, &alen);                // accept()
     if (cfd < 0) { perror("accept"); return; }                    // guard
     g_fds.push_back({cfd, POLLIN, 0});                            // watch for reads
-    std::cout << "[server] client fd=" << cfd << " connected\n";  // log
+    LOG_INFO("[server] client fd={} connected", cfd);             // log
 }
 
-// ---------- read one request from a client and process ----------
+// ---------- run one request line (CR/LF already stripped or absent) ----------
+static void dispatch_line(int fd, std::string line) {
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) // trim CR/LF
+        line.pop_back();                                          // drop trailing newline
+    LOG_INFO("[server] fd={} cmd: {}", fd, line);                 // log (long batches truncated)
+    handle_command(fd, line);                                     // parse + execute
+}
+
+static void drop_client(pollfd& p) {                              // close + forget its input
+    ::close(p.fd); g_pending.erase(p.fd);
+    p.fd = -1; p.events = 0; p.revents = 0;                       // mark as closed
+}
+
+// ---------- read what one recv() returns; run every complete line ----------
+// A BATCH line may span many reads: its bytes wait in g_pending and the loop
+// goes back to poll() until the newline arrives, so a slow sender never
+// stalls the other clients. Other requests keep the one-read-one-command
+// behaviour when they carry no newline.
 static void read_once(std::size_t idx) {
     auto& p = g_fds[idx];                                         // pollfd ref
     char buf[kBufSize];                                           // recv buffer
-    ssize_t n = ::recv(p.fd, buf, sizeof(buf) - 1, 0);            // receive bytes
+    ssize_t n = ::recv(p.fd, buf, sizeof(buf), 0);                // receive bytes
+    std::string& in = g_pending[p.fd];                            // this client's unfinished input
     if (n <= 0) {                                                 // disconnect or error
-        std::cout << "[server] client " << p.fd << " disconnected\n"; // log
-        ::close(p.fd); p.fd = -1; p.events = 0; p.revents = 0;    // mark as closed
+        LOG_INFO("[server] client {} disconnected", p.fd);       // log
+        drop_client(p);                                           // half a line is dropped
         return;                                                   // done
     }
-    buf[n] = '\0';                                                // null-terminate buffer
-    std::string line(buf);                                        // convert to std::string
-    while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) // trim CR/LF
-        line.pop_back();                                          // drop trailing newline
-    std::cout << "[server] fd=" << p.fd << " cmd: " << line << "\n"; // log
-    handle_command(p.fd, line);                                   // parse + execute
+    in.append(buf, (std::size_t)n);
+
+    std::size_t nl;
+    while ((nl = in.find('\n')) != std::string::npos) {          // every complete line
+        std::string line = in.substr(0, nl + 1);
+        in.erase(0, nl + 1);
+        dispatch_line(p.fd, std::move(line));
+    }
+    if (in.empty()) return;
+    if (lower(in.substr(0, 5)) != "batch") {                      // unterminated single request
+        dispatch_line(p.fd, std::move(in));
+        in.clear();
+    } else if (in.size() >= kMaxBatchBytes) {                     // never finishes: refuse it
+        LOG_INFO("[server] fd={} batch over {} bytes, closing", p.fd, kMaxBatchBytes);
+        send_all(p.fd, "Error: batch line too long\n");
+        drop_client(p);
+    }
 }
 
 int main() {
@@ -233,9 +365,9 @@ int main() {
     freeaddrinfo(res);                                              // free addr list
 
     g_fds.push_back({sfd, POLLIN, 0});                              // watch the listener
-    std::cout << "[server] listening on " << kIP << ":" << kPort << "\n"; // banner
+    LOG_INFO("[server] listening on {}:{}", kIP, kPort);          // banner
 
-    while (true) {                                                  // event loop
+    while (!g_stop) {                                               // event loop (until Ctrl+C)
         int nready = ::poll(g_fds.data(), g_fds.size(), kNoTimeout);// wait for events
         if (nready < 0) {                                           // poll error
             if (errno == EINTR) continue;                           // interrupted → resume
@@ -253,6 +385,8 @@ int main() {
                     g_fds.end());
     }
 
+    if (g_stop) LOG_INFO("[server] SIGINT -> shutdown");         // goodbye
     close_all();                                                    // close sockets
+    AsyncLog::shutdown();                                           // write pending log lines
     return 0;                                                       // done
 }
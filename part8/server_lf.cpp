@@ -5,8 +5,8 @@
 //   The leader blocks on accept(); once it accepts a client socket,          // leader behavior
 //   it immediately promotes a follower to be the new leader and then         // promotion step
 //   *processes* the client (reads one command, builds a graph, and           // worker step
-//   runs *all four* algorithms from Part 7), sends a combined reply,         // response
-//   and closes the client socket.                                            // lifecycle
+//   runs *all four* algorithms from Part 7 in parallel), sends a combined   // response
+//   reply, and closes the client socket.                                     // lifecycle
 // - Commands (one line, newline-terminated):                                 // protocol
 //     ALG ALL RANDOM <V> <E> <SEED> [--directed]                             // random graph
 //     ALG ALL MANUAL <V> : u-v u-v ... [--directed]                          // manual graph
@@ -15,6 +15,8 @@
 
 #include "graph/Graph.hpp"             // your Graph API (already in /include + /src)
 #include "algo/GraphAlgorithm.hpp"     // IGraphAlgorithm + AlgorithmFactory (Part 7)
+#include "algo/Parallel.hpp"           // shared ThreadPool + parallel_invoke fork-join
+#include "sys/Topology.hpp"            // CpuPlacement, MemoryPlacement (--pin / --mem)
 
 #include <arpa/inet.h>                 // inet_pton, htons
 #include <netdb.h>                     // getaddrinfo, freeaddrinfo
@@ -26,11 +28,14 @@
 #include <condition_variable>          // std::condition_variable
 #include <csignal>                     // std::signal
 #include <cstring>                     // std::strerror
+#include <exception>                   // std::exception from a failing strategy
+#include <functional>                  // std::function tasks for the fork-join
 #include <iostream>                    // std::cout, std::cerr
 #include <mutex>                       // std::mutex, std::unique_lock
 #include <random>                      // std::mt19937
 #include <set>                         // std::set
 #include <sstream>                     // std::istringstream, std::ostringstream
+#include <stdexcept>                   // std::invalid_argument from bad --pin / --mem specs
 #include <string>                      // std::string
 #include <thread>                      // std::thread
 #include <vector>                      // std::vector
@@ -177,23 +182,37 @@ static bool build_graph_from_command(const std::string& line, Graph& out, std::s
     return false;                                                                     // fail
 }
 
+// Run one strategy by id; failures become the reply text instead of escaping.   // single-algorithm runner
+static std::string run_one_algorithm(AlgorithmId id, const Graph& g) {
+    try {
+        return AlgorithmFactory::run(id, g);                                         // static dispatch, no allocation
+    } catch (const std::exception& e) {                                               // e.g. graph too large
+        return std::string("(error: ") + e.what() + ")";                              // report, keep the others
+    }
+}
+
 // Run all four algorithms via the Part 7 factory and format the combined reply.      // multi-algorithm runner
+// The four strategies are forked onto the shared ThreadPool and joined before the    // fork-join
+// reply is assembled, so latency is roughly the slowest one rather than the sum.     // latency note
+// Only workers that are idle right now are borrowed; the LF thread always runs        // capacity bound
+// tasks itself, so a busy pool degrades to the old sequential order.                  // no starvation
 static std::string run_all_algorithms(const Graph& g) {
-    std::ostringstream out;                                                          // build response
-    out << "Graph: " << g.label() << "\n";                                           // include graph label
+    static constexpr AlgorithmId kIds[] = {                                          // reply order
+        AlgorithmId::Mst, AlgorithmId::Scc, AlgorithmId::MaxFlow, AlgorithmId::Hamilton };
+    constexpr std::size_t kCount = sizeof(kIds) / sizeof(kIds[0]);                    // number of strategies
 
-    auto do_one = [&](const char* name){                                             // helper to run single algo
-        auto alg = AlgorithmFactory::create(name);                                    // create strategy by name
-        if (alg) out << name << ": " << alg->run(g) << "\n";                          // append result
-        else     out << name << ": (unavailable)\n";                                  // safety: if not linked
-    };
+    std::string results[kCount];                                                     // one slot per strategy
+    std::vector<std::function<void()>> tasks;                                        // fork-join tasks
+    tasks.reserve(kCount);                                                           // reserve capacity
+    for (std::size_t i = 0; i < kCount; ++i)                                         // one task per strategy
+        tasks.emplace_back([&, i]{ results[i] = run_one_algorithm(kIds[i], g); });    // writes only its slot
 
-    // Names expected by your Part 7 factory: "mst", "scc", "maxflow", "hamilton"     // supported set
-    do_one("MST");                                                                    // MST weight
-    do_one("SCC");                                                                    // SCC count
-    do_one("MAXFLOW");                                                                // Max flow 0→n-1
-    do_one("HAMILTON");                                                               // Hamiltonian circuit
+    parallel_invoke(tasks, 1 + ThreadPool::shared().idle());                         // fork, run, join
 
+    std::ostringstream out;                                                          // build response
+    out << "Graph: " << g.label() << "\n";                                           // include graph label
+    for (std::size_t i = 0; i < kCount; ++i)                                         // fixed order
+        out << AlgorithmFactory::name(kIds[i]) << ": " << results[i] << "\n";         // append result
     return out.str();                                                                 // return full reply
 }
 
@@ -305,7 +324,19 @@ static bool setup_listen_socket() {
     return true;                                                                     // success
 }
 
-int main() {
+int main(int argc, char** argv) {
+    CpuPlacement pin;                                                                // --pin SPEC (default: unpinned)
+    for (int i = 1; i < argc; ++i) {                                                 // options
+        const std::string a = argv[i];                                               // current flag
+        try {
+            if (i + 1 < argc && a == "--pin") { pin = CpuPlacement::parse(argv[++i]); continue; }                // worker placement
+            if (i + 1 < argc && a == "--mem") { MemoryPlacement::setGraphs(MemoryPlacement::parse(argv[++i])); continue; } // graph views
+        } catch (const std::invalid_argument& e) {
+            std::cerr << e.what() << "\n";                                           // bad spec
+        }
+        std::cerr << "Usage: " << argv[0] << " [--pin SPEC] [--mem SPEC]\n";          // unknown flag
+        return 2;                                                                    // bad usage
+    }
     std::signal(SIGINT, on_sigint);                                                  // register Ctrl+C handler
 
     if (!setup_listen_socket()) return 1;                                            // setup listening socket
@@ -317,6 +348,9 @@ int main() {
     std::vector<std::thread> pool;                                                   // thread container
     pool.reserve(nThreads);                                                          // reserve capacity
     for (unsigned i=0;i<nThreads;++i) pool.emplace_back(worker_thread);              // spawn workers
+    for (unsigned i=0;i<nThreads;++i)                                                // place workers (best-effort)
+        if (!pin.pin(pool[i], i)) std::cerr << "[LF server] could not pin worker " << i << "\n";
+    ThreadPool::shared().pin(pin);                                                   // fork-join helpers on the same CPUs
 
     // Initially, there is no leader → wake one follower to become leader.            // kickstart leadership
     {
@@ -6,35 +6,62 @@
 //   ALG ALL MANUAL <V> : u-v u-v ... [--directed]                              // manual-mode syntax
 //                                                                              // spacer
 // Stages (each is an Active Object = a thread + a blocking queue):             // pipeline overview
-//   [MAIN acceptor] -> (Stage 1) Parse+BuildGraph AO                            // accept -> parser stage
+//   (Stage 0) Ingress reactor (epoll accept + non-blocking framing)            // accept/recv, idle timeouts
+//                    -> (Stage 1) Parse+BuildGraph AOs (pool of --parsers)     // accept -> parser stage
 //                    -> (Stage 2) Dispatcher AO (fan out)                      // then to dispatcher
 //                    -> (Stage 3a) MST AO                                      // dedicated algorithm workers
 //                    -> (Stage 3b) SCC AO                                       // ...
 //                    -> (Stage 3c) MAXFLOW AO                                   // ...
 //                    -> (Stage 3d) HAMILTON AO                                  // ...
 //                    -> (Stage 4) Aggregator AO (fan in)                        // results merged
-//                    -> (Stage 5) Sender AO                                     // send reply
+//                    -> (Stage 5) Egress reactor (epoll, non-blocking writes)   // send reply
 //                                                                              // spacer
 // Notes:                                                                       // notes section
 //  * Reuses your Part-7 Strategy/Factory via AlgorithmFactory.                 // reuse of existing code
 //  * Uses a simple thread-safe BlockingQueue<T> per stage.                     // mailbox per stage
+//  * Stages hand items over in batches (one lock + one wake-up per batch).     // drain-many handoff
+//  * Small requests run to completion on the ingress thread (no handoffs);     // cost-based routing
+//    only large ones take the staged, fanned-out path. --fuse merges the       // optional stage fusion
+//    parser and dispatcher into one thread.                                    // ...
+//  * Parsing runs on a pool of parser workers; jobs flow on as each finishes  // no parse head-of-line
+//    (the aggregator keys by request id). Huge edge lists parse in chunks.     // intra-request parallelism
+//  * Replies leave through per-connection output queues flushed on EPOLLOUT,  // no head-of-line blocking
+//    so a client that stops reading only delays itself (and is evicted).       // slow-client policy
+//  * Requests are framed per connection without blocking; a client that      // no head-of-line blocking
+//    connects and stays silent is closed by a timer wheel, costing no thread.  // idle policy
+//  * Stage threads can be pinned per stage (--pin [STAGE=]SPEC) and cached     // NUMA placement
+//    graph views placed on NUMA nodes (--mem SPEC); big arrays use huge pages  // ...
+//    (--pages off|thp|hugetlb[+prefault]); see sys/Topology.hpp, BigAlloc.hpp. // ...
 //  * Clean shutdown on Ctrl+C.                                                 // shutdown behavior
 // ============================================================================ // end banner
 
 #include "graph/Graph.hpp"             // our Graph API (in include/graph)                       // include graph interface
 #include "algo/GraphAlgorithm.hpp"     // IGraphAlgorithm + AlgorithmFactory                      // include strategy/factory
+#include "algo/Parallel.hpp"           // parallel_for                                           // chunked edge-list parsing
+#include "sys/Topology.hpp"            // CpuPlacement, MemoryPlacement                          // thread + graph placement
+#include "sys/BigAlloc.hpp"            // BigAlloc policy                                        // huge pages for big arrays
 
 #include <arpa/inet.h>                 // inet_pton, htons, etc.                                 // sockets header
 #include <netdb.h>                     // getaddrinfo, freeaddrinfo                              // address resolution
+#include <fcntl.h>                     // fcntl, O_NONBLOCK                                      // non-blocking client fds
+#include <sys/epoll.h>                 // epoll_create1, epoll_ctl, epoll_wait                   // egress reactor
+#include <sys/eventfd.h>               // eventfd                                                // wake the reactor
 #include <sys/socket.h>                // socket, bind, listen, accept, send, recv               // socket API
 #include <unistd.h>                    // close, shutdown                                        // POSIX close/shutdown
 
 #include <algorithm>                   // std::minmax                                            // algorithm utilities
 #include <atomic>                      // std::atomic                                            // atomic flags
+#include <cctype>                      // std::isspace, std::tolower                             // character classes
+#include <cerrno>                      // errno, EAGAIN, EINTR                                   // socket error codes
+#include <charconv>                    // std::from_chars                                        // non-throwing int parse
+#include <chrono>                      // std::chrono::steady_clock                              // stall timeouts
 #include <condition_variable>          // std::condition_variable                                // threading primitive
 #include <csignal>                     // std::signal                                            // signal handling
+#include <cstdlib>                     // std::strtoul                                           // batch-size argument
 #include <cstring>                     // std::strerror                                          // C string utilities
+#include <deque>                       // std::deque                                             // output segments
 #include <iostream>                    // std::cout, std::cerr                                   // IO streams
+#include <iterator>                    // std::make_move_iterator                                // segment moves
 #include <map>                         // std::map                                               // map for aggregator
 #include <memory>                      // std::shared_ptr, std::make_shared                      // smart pointers
 #include <mutex>                       // std::mutex, std::lock_guard, std::unique_lock          // mutex types
@@ -43,8 +70,12 @@
 #include <random>                      // std::mt19937, distributions                            // RNG for random graphs
 #include <set>                         // std::set                                               // dedup edges
 #include <sstream>                     // std::istringstream, std::ostringstream                 // string streams
+#include <stdexcept>                   // std::invalid_argument                                  // bad --pin / --mem specs
 #include <string>                      // std::string                                            // strings
+#include <string_view>                 // std::string_view                                       // edge tokens
 #include <thread>                      // std::thread                                            // threads
+#include <unordered_map>               // std::unordered_map                                     // fd -> connection
+#include <unordered_set>               // std::unordered_set                                     // edge dedupe
 #include <utility>                     // std::move, std::pair                                   // utility
 #include <vector>                      // std::vector                                            // vectors
 
@@ -53,6 +84,52 @@ static constexpr const char* kIP   = "127.0.0.1";           // bind IP (loopback
 static constexpr const char* kPort = "5555";                // bind port (string)
 static constexpr int         kBacklog = 32;                 // listen backlog
 static constexpr int         kBufSz   = 4096;               // recv buffer size
+static constexpr std::size_t kMaxLineBytes     = 1u << 20;  // longest accepted request line
+static constexpr std::size_t kStageBatch       = 32;        // default items drained per queue lock
+static std::size_t           g_batch = kStageBatch;         // effective batch size (--batch N)
+static constexpr std::size_t kInlineMaxV       = 10;        // default and largest run-to-completion size limit
+static std::size_t           g_inline_max_v = kInlineMaxV;  // requests up to this V run inline (--inline-max V, 0 = never)
+static bool                  g_fuse = false;                // parser fans out itself (--fuse)
+static constexpr std::size_t kParserThreads    = 4;         // default parser pool size
+static std::size_t           g_parsers = kParserThreads;    // parser workers (--parsers P)
+static constexpr std::size_t kParseChunkTokens = 8192;      // MANUAL edge tokens per parallel parse chunk
+static constexpr int         kIngressIdleMs    = 10000;     // close a client that completes no line in time
+static constexpr int         kIngressTickMs    = 100;       // timer wheel granularity
+static constexpr std::size_t kIngressWheelSlots = 128;      // wheel size (power of two)
+static constexpr std::size_t kEgressMaxPending = 8u << 20;  // evict a client with more unsent bytes than this
+static constexpr int         kEgressStallMs    = 5000;      // evict a client that accepts nothing for this long
+static constexpr int         kEgressTickMs     = 250;       // reactor wake-up period while writes are pending
+static constexpr int         kEgressMaxIov     = 64;        // segments gathered per sendmsg()
+
+// ============ thread placement ============
+enum PinStage { kPinIngress, kPinEgress, kPinParsers, kPinDispatcher, kPinWorkers, kPinAggregator, kPinPool, kPinStages };
+static const char* const kPinStageNames[kPinStages] =      // names accepted by --pin STAGE=SPEC
+    { "ingress", "egress", "parsers", "dispatcher", "workers", "aggregator", "pool" };
+static CpuPlacement                g_pin_all;               // --pin SPEC: every stage thread, one index each
+static std::optional<CpuPlacement> g_pin_stage[kPinStages]; // --pin STAGE=SPEC: own policy, own indices
+static unsigned                    g_pin_next = 0;          // next index under g_pin_all
+
+// Parse "SPEC" or "STAGE=SPEC"; false (with a message) for bad input.
+static bool parse_pin(const std::string& arg) {             // one --pin option
+    const std::size_t eq = arg.find('=');                   // stage prefix?
+    try {
+        if (eq == std::string::npos) { g_pin_all = CpuPlacement::parse(arg); return true; } // whole pipeline
+        const std::string stage = arg.substr(0, eq);        // stage name
+        for (int s = 0; s < kPinStages; ++s)                // look it up
+            if (stage == kPinStageNames[s]) { g_pin_stage[s] = CpuPlacement::parse(arg.substr(eq + 1)); return true; }
+        std::cerr << "--pin: unknown stage '" << stage << "'\n"; // bad stage
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "--pin: " << e.what() << "\n";         // bad spec
+    }
+    return false;                                           // caller prints usage
+}
+
+// Pin the i-th thread of `stage` (a stage policy wins over the pipeline-wide one).
+static void place(std::thread& t, PinStage stage, unsigned i) { // after the thread started
+    const bool ok = g_pin_stage[stage] ? g_pin_stage[stage]->pin(t, i) // stage policy
+                                       : g_pin_all.pin(t, g_pin_next++); // pipeline-wide policy
+    if (!ok) std::cerr << "[Pipeline server] could not pin a " << kPinStageNames[stage] << " thread\n"; // best-effort
+}
 
 // ============ small helpers ============
 static std::string lower(std::string s) {                   // lowercase helper
@@ -60,17 +137,6 @@ static std::string lower(std::string s) {                   // lowercase helper
     return s;                                               // return modified string
 }
 
-static void send_all(int fd, const std::string& s) {        // send whole string
-    const char* p = s.c_str();                              // raw pointer to data
-    std::size_t left = s.size();                            // bytes left to send
-    while (left) {                                          // loop until done
-        ssize_t n = ::send(fd, p, left, 0);                 // attempt to send
-        if (n <= 0) return;                                 // bail on error/closed
-        p += n;                                             // advance pointer
-        left -= (std::size_t)n;                             // reduce remaining
-    }
-}
-
 // ============ BlockingQueue<T> (Active Object mailbox) ============
 template <typename T>
 class BlockingQueue {                                       // simple thread-safe queue
@@ -84,6 +150,18 @@ public:
         cv_.notify_one();                                   // wake a waiting pop
     }
 
+    // Enqueue every item of `vs` under one lock and one wake-up; `vs` is left empty.
+    void push_many(std::vector<T>& vs) {                    // enqueue a batch
+        if (vs.empty()) return;                             // nothing to do
+        {
+            std::lock_guard<std::mutex> lk(mu_);            // lock once
+            if (!closed_)                                   // ignore if closed
+                for (auto& v : vs) q_.push(std::move(v));   // push all
+        }
+        vs.clear();                                         // hand-off done
+        cv_.notify_one();                                   // the woken consumer drains many
+    }
+
     // Blocks until item available or queue closed; returns nullopt when closed and empty.
     std::optional<T> pop() {                                // dequeue (blocking)
         std::unique_lock<std::mutex> lk(mu_);              // lock with unique_lock
@@ -94,6 +172,23 @@ public:
         return v;                                           // return item
     }
 
+    // Blocks like pop(), then moves up to `max` items into `out` (cleared first) under
+    // the same lock. Returns false once the queue is closed and drained.
+    bool pop_many(std::vector<T>& out, std::size_t max) {   // dequeue a batch (blocking)
+        out.clear();                                        // fresh batch
+        std::unique_lock<std::mutex> lk(mu_);              // lock with unique_lock
+        cv_.wait(lk, [&]{ return closed_ || !q_.empty(); });// wait for item/close
+        if (q_.empty()) return false;                       // closed and drained
+        while (!q_.empty() && out.size() < max) {           // take what is there, up to max
+            out.push_back(std::move(q_.front()));           // move front
+            q_.pop();                                       // pop it
+        }
+        const bool more = !q_.empty();                      // leftovers for another consumer?
+        lk.unlock();                                        // release before waking
+        if (more) cv_.notify_one();                         // pass the baton
+        return true;                                        // got at least one
+    }
+
     void close() {                                          // close the queue
         {
             std::lock_guard<std::mutex> lk(mu_);            // lock
@@ -128,7 +223,7 @@ struct GraphJob {                                           // parsed/built grap
 struct AlgoTask {                                           // task for a specific algorithm
     int                          client_fd;                 // client socket fd
     std::shared_ptr<Graph>       g;                         // shared graph
-    std::string                  algoName;                  // "MST","SCC","MAXFLOW","HAMILTON"
+    AlgorithmId                  algo;                      // MST, SCC, MAXFLOW or HAMILTON
     std::string                  label;                     // graph label text
     ReqId                        id;                        // request id
 };
@@ -142,14 +237,15 @@ struct AlgoResult {                                         // result produced b
 };
 
 struct Response {                                           // final aggregated response
-    int         client_fd;                                   // client socket fd
-    std::string payload;                                     // payload to send
-    ReqId       id;                                          // request id (unused in sender)
+    int                      client_fd;                      // client socket fd
+    std::vector<std::string> segments;                       // payload pieces, written with one gather call
+    ReqId                    id;                             // request id (unused in sender)
 };
 
 // ============ global stop flag + sigint ============
 static std::atomic<bool> g_stop{false};                     // global stop flag
 static int g_listen_fd = -1;                                // listening socket
+static int g_wake_fd   = -1;                                // eventfd that wakes the ingress reactor
 
 static void close_listen_fd() {                             // close listening socket
     if (g_listen_fd >= 0) { ::close(g_listen_fd); g_listen_fd = -1; } // close if open
@@ -157,10 +253,24 @@ static void close_listen_fd() {                             // close listening s
 
 static void on_sigint(int) {                                // SIGINT handler
     g_stop.store(true);                                     // set stop flag
-    close_listen_fd();                                      // unblock accept()
+    if (g_wake_fd >= 0) {                                   // wake the ingress reactor
+        uint64_t one = 1;                                   // counter increment
+        ssize_t k = ::write(g_wake_fd, &one, sizeof(one));  // async-signal-safe
+        (void)k;                                            // nothing to do on failure
+    }
 }
 
 // ============ Graph builders (same semantics as part 8) ============
+// Most edges a simple graph on V vertices can have (saturates instead of overflowing).
+static std::size_t max_edges(std::size_t V, bool directed) {
+    if (V > UINT32_MAX) return SIZE_MAX;                    // beyond any request we could build
+    const std::size_t pairs = V * (V - 1);                  // ordered pairs u != v
+    return directed ? pairs : pairs / 2;                    // arcs / edges
+}
+
+// The caller checks E <= max_edges(V, directed). Random picks stop after a fixed number
+// of tries; if that ever leaves edges missing, the remaining free pairs are taken in
+// order, so every call is bounded even for nearly complete graphs.
 static Graph make_random_graph(std::size_t V, std::size_t E, unsigned seed, bool directed) { // build random graph
     Graph::Options opt; opt.allowSelfLoops=false; opt.allowMultiEdges=false; // disallow loops/multiedges
     Graph g(V, directed? Graph::Kind::Directed : Graph::Kind::Undirected, opt); // construct graph
@@ -169,29 +279,48 @@ static Graph make_random_graph(std::size_t V, std::size_t E, unsigned seed, bool
     std::uniform_int_distribution<int> pick(0,(int)V-1);    // vertex picker
     std::set<std::pair<int,int>> seen;                      // dedupe set
     std::size_t added = 0;                                  // edges added
+    auto take = [&](int u, int v) {                         // add u-v unless already present
+        const auto key = directed ? std::make_pair(u,v) : std::make_pair(std::min(u,v), std::max(u,v)); // canonical key
+        if (!seen.insert(key).second) return;               // duplicate
+        g.addEdge(u,v,1);                                   // add arc / edge with weight 1
+        ++added;                                            // count edge
+    };
 
-    while (!g_stop.load() && added < E) {                   // until enough edges or stop
+    const std::size_t tries = 32 * E + 64;                  // expected need is far lower unless E ~ max
+    for (std::size_t t = 0; t < tries && !g_stop.load() && added < E; ++t) { // random phase
         int u = pick(rng), v = pick(rng);                   // choose endpoints
-        if (u == v) continue;                               // skip self-loop
-        if (directed) {                                     // directed case
-            auto key = std::make_pair(u,v);                 // directed unique key
-            if (seen.count(key)) continue;                  // skip duplicate arc
-            g.addEdge(u,v,1);                               // add arc with weight 1
-            seen.insert(key);                               // remember arc
-        } else {                                            // undirected case
-            auto mm = std::minmax(u,v);                     // canonical (min,max)
-            if (seen.count(mm)) continue;                   // skip duplicate edge
-            g.addEdge(u,v,1);                               // add undirected edge
-            seen.insert(mm);                                // remember edge
-        }
-        ++added;                                            // count edge
+        if (u != v) take(u, v);                             // skip self-loop
     }
+    for (int u = 0; added < E && !g_stop.load() && u < (int)V; ++u) // fill phase (rarely reached)
+        for (int v = directed ? 0 : u + 1; added < E && v < (int)V; ++v)
+            if (u != v) take(u, v);
     return g;                                               // return graph
 }
 
+// One MANUAL edge token, parsed like std::stoi on both halves ("u-v", anything after
+// v's digits is ignored) but without throwing: a missing or out-of-range number is a
+// bad token. Independent per token, so large edge lists are parsed in parallel chunks.
+struct EdgeToken {                                          // parse result of one token
+    enum Status : unsigned char { Ok, Bad, Invalid } status; // Invalid = range / self-loop
+    std::uint32_t u, v;                                     // endpoints when Ok
+};
+
+static EdgeToken parse_edge_token(std::string_view t, std::size_t V) { // classify one token
+    const auto dash = t.find('-');                          // locate '-'
+    if (dash == std::string_view::npos) return { EdgeToken::Bad, 0, 0 }; // malformed
+    long long u = 0, v = 0;                                 // wide: range is checked below
+    const char* const end = t.data() + t.size();            // token end
+    auto ru = std::from_chars(t.data(), t.data() + dash, u);// parse u
+    auto rv = std::from_chars(t.data() + dash + 1, end, v); // parse v (trailing text ignored)
+    if (ru.ec != std::errc() || rv.ec != std::errc()) return { EdgeToken::Bad, 0, 0 }; // no number
+    if (u < 0 || v < 0 || (std::size_t)u >= V || (std::size_t)v >= V || u == v)
+        return { EdgeToken::Invalid, 0, 0 };                // validate range
+    return { EdgeToken::Ok, (std::uint32_t)u, (std::uint32_t)v }; // good edge
+}
+
 // Parse: "ALG ALL MANUAL <V> : u-v u-v ... [--directed]"
 static bool parse_manual_all(const std::string& line, Graph& out, std::string& err) { // parse manual command
-    std::istringstream iss(line);                         // tokenizer
+    std::istringstream iss(line);                         // tokenizer (header only)
     std::string kw1, kw2, mode; iss >> kw1 >> kw2 >> mode; // read ALG ALL MODE
     if (lower(kw1)!="alg" || lower(kw2)!="all" || lower(mode)!="manual") { // validate
         err = "Expected: ALG ALL MANUAL <V> : u-v u-v ... [--directed]";    // error text
@@ -199,31 +328,48 @@ static bool parse_manual_all(const std::string& line, Graph& out, std::string& e
     }
     std::size_t V=0; char colon=0; iss >> V >> colon;       // read V and ':'
     if (V==0 || colon!=':') { err = "Format: ALG ALL MANUAL <V> : u-v ... [--directed]"; return false; } // validate
-
-    std::vector<std::string> toks; std::string tok;         // tokens after ':'
-    while (iss >> tok) toks.push_back(tok);                 // collect tokens
+    if (V > UINT32_MAX) { err = "V too large"; return false; } // endpoints are stored as 32-bit
+
+    std::vector<std::string_view> toks;                     // tokens after ':' (views into line)
+    const std::string_view rest = std::string_view(line).substr((std::size_t)iss.tellg()); // edge list
+    for (std::size_t i = 0; i < rest.size();) {             // split on whitespace
+        while (i < rest.size() && std::isspace((unsigned char)rest[i])) ++i; // skip blanks
+        std::size_t j = i;                                  // token end
+        while (j < rest.size() && !std::isspace((unsigned char)rest[j])) ++j; // scan token
+        if (j > i) toks.push_back(rest.substr(i, j - i));   // keep token
+        i = j;                                              // continue
+    }
 
     bool directed=false;                                    // directed flag
     if (!toks.empty() && toks.back()=="--directed"){ directed=true; toks.pop_back(); } // trailing flag
 
+    std::vector<EdgeToken> parsed(toks.size());             // per-token results, in input order
+    auto parse_range = [&](std::size_t lo, std::size_t hi, unsigned) { // parse a chunk
+        for (std::size_t i = lo; i < hi; ++i) parsed[i] = parse_edge_token(toks[i], V);
+    };
+    if (toks.size() >= 2 * kParseChunkTokens) parallel_for(toks.size(), kParseChunkTokens, parse_range); // large: chunks in parallel
+    else parse_range(0, toks.size(), 0);                    // small: not worth a fork
+
     Graph::Options opt; opt.allowSelfLoops=false; opt.allowMultiEdges=false; // options
     out = Graph(V, directed? Graph::Kind::Directed : Graph::Kind::Undirected, opt); // build target graph
 
-    std::set<std::pair<int,int>> seen;                      // dedupe set
-    for (auto& t: toks) {                                   // for each edge token
-        auto dash = t.find('-');                            // locate '-'
-        if (dash==std::string::npos) { err="Bad token: "+t; return false; } // malformed
-        int u = std::stoi(t.substr(0,dash));                // parse u
-        int v = std::stoi(t.substr(dash+1));                // parse v
-        if (u<0 || v<0 || (std::size_t)u>=V || (std::size_t)v>=V || u==v) { err="Invalid endpoints: "+t; return false; } // validate range
+    // Merge in input order so the first error and the edge order match a sequential parse.
+    std::unordered_set<std::uint64_t> seen;                 // dedupe set (packed pair)
+    seen.reserve(toks.size());                              // one entry per edge
+    for (std::size_t i = 0; i < toks.size(); ++i) {         // for each edge token
+        const EdgeToken& e = parsed[i];                     // parsed form
+        const std::string_view t = toks[i];                 // for error text
+        if (e.status == EdgeToken::Bad)     { err="Bad token: "+std::string(t); return false; }         // malformed
+        if (e.status == EdgeToken::Invalid) { err="Invalid endpoints: "+std::string(t); return false; } // validate range
         if (out.directed()) {                                // directed
-            auto key = std::make_pair(u,v);                 // directed key
-            if (seen.count(key)) { err="Duplicate arc: "+t; return false; } // check dup
-            seen.insert(key); out.addEdge(u,v,1);           // add arc
+            const std::uint64_t key = (std::uint64_t)e.u << 32 | e.v; // directed key
+            if (!seen.insert(key).second) { err="Duplicate arc: "+std::string(t); return false; } // check dup
+            out.addEdge(e.u,e.v,1);                         // add arc
         } else {                                            // undirected
-            auto mm = std::minmax(u,v);                     // canon pair
-            if (seen.count(mm)) { err="Duplicate edge: "+t; return false; } // check dup
-            seen.insert(mm); out.addEdge(u,v,1);            // add edge
+            auto mm = std::minmax(e.u,e.v);                 // canon pair
+            const std::uint64_t key = (std::uint64_t)mm.first << 32 | mm.second; // undirected key
+            if (!seen.insert(key).second) { err="Duplicate edge: "+std::string(t); return false; } // check dup
+            out.addEdge(e.u,e.v,1);                         // add edge
         }
     }
     return true;                                            // success
@@ -245,6 +391,10 @@ static bool build_graph_from_command(const std::string& line, Graph& out, std::s
         iss >> V >> E >> seed >> flag;                      // parse params
         if (V==0) { err="V must be > 0"; return false; }    // validate V
         const bool directed = (flag=="--directed");         // detect flag
+        if (E > max_edges(V, directed)) {                   // unsatisfiable: never start building
+            err = "E too large: at most " + std::to_string(max_edges(V, directed)) + " edges for V=" + std::to_string(V);
+            return false;
+        }
         out = make_random_graph(V, E, seed, directed);      // build random graph
         return true;                                        // success
     }
@@ -254,66 +404,483 @@ static bool build_graph_from_command(const std::string& line, Graph& out, std::s
     return false;                                           // fail
 }
 
+// Reply text, one segment per line (shared by the aggregator and the inline path).
+static std::vector<std::string> reply_segments(const std::string& label, std::string mst, std::string scc,
+                                               std::string maxflow, std::string hamilton) {
+    std::vector<std::string> segs;                          // one segment per reply line
+    segs.reserve(5);                                        // header + four results
+    segs.push_back("Graph: "    + label    + "\n");         // header
+    segs.push_back("MST: "      + mst      + "\n");         // MST line
+    segs.push_back("SCC: "      + scc      + "\n");         // SCC line
+    segs.push_back("MAXFLOW: "  + maxflow  + "\n");         // MaxFlow line
+    segs.push_back("HAMILTON: " + hamilton + "\n");         // Hamilton line
+    return segs;                                            // ready for the egress
+}
+
+// Cost estimate from the header alone: true when the request is small enough to run
+// to completion on the receiving thread (V <= g_inline_max_v and E <= 4 * that).
+// The V limit never exceeds kInlineMaxV: HAMILTON backtracks over up to (V-1)!
+// paths, about 0.2 ms for the worst 10-vertex graph but seconds at 16 (K7,9).
+// MANUAL edges are counted, not parsed; anything unusual takes the staged path.
+// An unsatisfiable RANDOM E is accepted here and rejected by the builder before
+// any graph exists.
+static bool fits_inline(const std::string& line) {          // cheap size check
+    if (g_inline_max_v == 0 || line.size() > 64 * g_inline_max_v) return false; // disabled / too long to be small
+    std::istringstream iss(line);                           // tokenizer
+    std::string kw1, kw2, mode; iss >> kw1 >> kw2 >> mode;  // read ALG ALL MODE
+    std::size_t V = 0, E = 0;                               // size estimate
+    if (lower(mode) == "random") {                          // RANDOM: sizes are given
+        if (!(iss >> V >> E)) return false;                 // malformed
+    } else if (lower(mode) == "manual") {                   // MANUAL: count edge tokens
+        char colon = 0;                                     // ':' separator
+        if (!(iss >> V >> colon)) return false;             // malformed
+        std::string tok;                                    // edge token
+        while (iss >> tok) E += (tok != "--directed");      // count edges
+    } else {
+        return false;                                       // parser reports the error
+    }
+    return V <= g_inline_max_v && E <= 4 * g_inline_max_v; // small enough
+}
+
+// Run-to-completion: parse, build and answer on the calling thread.
+static std::vector<std::string> run_to_completion(const std::string& line) {
+    Graph g; std::string err;                               // local graph + error
+    if (!build_graph_from_command(line, g, err)) return { "Error: " + err + "\n" }; // same text as the parser
+    return reply_segments(g.label(),                        // same text as the aggregator
+                          AlgorithmFactory::run(AlgorithmId::Mst, g),
+                          AlgorithmFactory::run(AlgorithmId::Scc, g),
+                          AlgorithmFactory::run(AlgorithmId::MaxFlow, g),
+                          AlgorithmFactory::run(AlgorithmId::Hamilton, g));
+}
+
 // ============ Active Objects (stages) ============
 
-// -------- Stage 1: Parse + Build Graph --------
-class ParserStage {                                         // parser AO
+// -------- Stage 5: Egress reactor (non-blocking sender) --------
+// Defined first because the parser (error replies) and the aggregator both post to it.
+// Any stage hands a finished reply to post(); from then on the egress thread owns the
+// client fd. It writes immediately and, when the socket buffer is full, keeps the rest
+// in the connection's output queue and waits for EPOLLOUT, so one client that stops
+// reading never delays the replies of others. A client whose backlog grows past
+// kEgressMaxPending, or that accepts nothing for kEgressStallMs, is evicted.
+class EgressStage {                                         // egress AO (epoll reactor)
 public:
-    ParserStage(BlockingQueue<ClientMsg>& in, BlockingQueue<GraphJob>& out) // ctor wires queues
-      : in_(in), out_(out), th_([this]{ run(); }) {}        // spawn thread running run()
+    EgressStage()                                           // ctor: epoll set + wake-up eventfd
+      : ep_(::epoll_create1(EPOLL_CLOEXEC)),                // readiness set for blocked writers
+        wake_(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),    // post()/stop() -> reactor doorbell
+        th_() {
+        epoll_event ev{}; ev.events = EPOLLIN; ev.data.fd = wake_; // watch the doorbell
+        ::epoll_ctl(ep_, EPOLL_CTL_ADD, wake_, &ev);        // register it
+        th_ = std::thread([this]{ run(); });                // start reactor thread
+    }
+    ~EgressStage() { stop(); join(); ::close(wake_); ::close(ep_); } // release reactor fds
+
+    void post(Response r) {                                 // enqueue a reply (any thread)
+        {
+            std::lock_guard<std::mutex> lk(mu_);            // lock inbox
+            inbox_.push_back(std::move(r));                 // hand over
+        }
+        ring();                                             // wake reactor
+    }
+
+    void post_many(std::vector<Response>& rs) {             // enqueue a batch; `rs` is left empty
+        if (rs.empty()) return;                             // nothing to do
+        {
+            std::lock_guard<std::mutex> lk(mu_);            // lock inbox once
+            for (auto& r : rs) inbox_.push_back(std::move(r)); // hand over all
+        }
+        rs.clear();                                         // keep caller's capacity
+        ring();                                             // one wake-up per batch
+    }
+
+    // Run-to-completion path: write on the caller's thread while the socket takes it and
+    // close, with no handoff at all. Only an unsent remainder (full socket buffer) or
+    // a hard error is passed to the reactor, which then owns the fd as usual.
+    void send_inline(int fd, std::vector<std::string> segs) {
+        std::deque<std::string> out(std::make_move_iterator(segs.begin()), std::make_move_iterator(segs.end()));
+        std::size_t head = 0;                               // bytes of out.front() already sent
+        while (!out.empty()) {                              // until drained or blocked
+            if (send_some(fd, out, head) >= 0) continue;    // progress
+            if (errno == EINTR) continue;                   // retry
+            out.front().erase(0, head);                     // drop the sent prefix
+            post(Response{ fd, std::vector<std::string>(std::make_move_iterator(out.begin()),
+                                                        std::make_move_iterator(out.end())), 0 }); // reactor finishes (or evicts)
+            return;                                         // fd handed over
+        }
+        ::shutdown(fd, SHUT_RDWR);                          // shutdown socket
+        ::close(fd);                                        // close socket
+    }
+
+    void stop() {                                           // flush what fits, then close all
+        {
+            std::lock_guard<std::mutex> lk(mu_);            // lock inbox
+            stopping_ = true;                               // mark stopping
+        }
+        ring();                                             // wake reactor
+    }
 
     void join() { if (th_.joinable()) th_.join(); }         // join on shutdown
+    std::thread& thread() { return th_; }                   // for CPU placement
 
 private:
+    using Clock = std::chrono::steady_clock;                // monotonic clock for stalls
+
+    struct Conn {                                           // per-connection output state
+        std::deque<std::string> out;                        // segments not fully written yet
+        std::size_t             head = 0;                   // bytes of out.front() already sent
+        std::size_t             pending = 0;                // unsent bytes over all segments
+        Clock::time_point       progress{};                 // last time the client accepted bytes
+        bool                    armed = false;              // registered for EPOLLOUT
+    };
+
+    void ring() {                                           // signal the eventfd
+        uint64_t one = 1;                                   // counter increment
+        ssize_t k = ::write(wake_, &one, sizeof(one));      // never blocks (EFD_NONBLOCK)
+        (void)k;                                            // a saturated counter still wakes us
+    }
+
     void run() {                                            // thread body
-        while (!g_stop.load()) {                            // loop until stop
-            auto msg = in_.pop();                           // pop a client message
-            if (!msg) break;                                // queue drained
-            Graph g; std::string err;                       // local graph + error
-            if (!build_graph_from_command(msg->line, g, err)) { // parse/build
-                send_all(msg->client_fd, "Error: " + err + "\n"); // send error
-                ::shutdown(msg->client_fd, SHUT_RDWR);      // shutdown socket
-                ::close(msg->client_fd);                    // close socket
-                continue;                                   // next item
+        std::vector<epoll_event> evs(64);                   // ready list
+        std::vector<Response> batch;                        // inbox snapshot
+        for (;;) {                                          // reactor loop
+            const int timeout = conns_.empty() ? -1 : kEgressTickMs; // tick only while writes wait
+            int n = ::epoll_wait(ep_, evs.data(), (int)evs.size(), timeout); // wait for readiness
+            if (n < 0 && errno != EINTR) { std::perror("epoll_wait"); break; } // fatal reactor error
+            for (int i = 0; i < n; ++i) {                   // handle ready fds
+                const int fd = evs[i].data.fd;              // which fd
+                if (fd == wake_) {                          // doorbell
+                    uint64_t cnt; ssize_t k = ::read(wake_, &cnt, sizeof(cnt)); (void)k; // reset counter
+                    continue;                               // inbox handled below
+                }
+                auto it = conns_.find(fd);                  // connection state
+                if (it == conns_.end()) continue;           // already finished/evicted
+                if (evs[i].events & EPOLLERR) { evict(fd, "socket error"); continue; } // peer gone
+                flush(fd, it->second);                      // EPOLLOUT: write what fits now
+            }
+
+            bool stopping;                                  // stop requested?
+            {
+                std::lock_guard<std::mutex> lk(mu_);        // lock inbox
+                batch.swap(inbox_);                         // take all posted replies at once
+                stopping = stopping_;                       // sample flag
+            }
+            for (auto& r : batch) enqueue(std::move(r));    // queue + try immediate write
+            batch.clear();                                  // keep capacity
+
+            const auto now = Clock::now();                  // stall check
+            std::vector<int> stalled;                       // fds to evict (not while iterating)
+            for (auto& [fd, c] : conns_)                    // every blocked writer
+                if (now - c.progress > std::chrono::milliseconds(kEgressStallMs)) stalled.push_back(fd);
+            for (int fd : stalled) evict(fd, "no progress");// drop stuck clients
+
+            if (stopping) {                                 // shutdown: do not wait for slow readers
+                std::vector<int> rest;                      // everything still pending
+                for (auto& kv : conns_) rest.push_back(kv.first);
+                for (int fd : rest) evict(fd, "server shutting down");
+                break;                                      // reactor done
             }
-            auto sp = std::make_shared<Graph>(std::move(g)); // share graph
-            GraphJob gj{ msg->client_fd, sp, sp->label(), msg->id }; // build job
-            out_.push(std::move(gj));                       // push to next stage
         }
     }
 
-    BlockingQueue<ClientMsg>& in_;                          // input queue
-    BlockingQueue<GraphJob>&  out_;                         // output queue
-    std::thread th_;                                        // worker thread
+    void enqueue(Response&& r) {                            // take ownership of a reply
+        const int fd = r.client_fd;                         // client socket
+        const int fl = ::fcntl(fd, F_GETFL, 0);             // current flags
+        if (fl >= 0) ::fcntl(fd, F_SETFL, fl | O_NONBLOCK); // writes must never block the reactor
+        Conn& c = conns_[fd];                               // new or existing connection
+        for (auto& seg : r.segments) {                      // append non-empty segments
+            if (seg.empty()) continue;                      // nothing to send
+            c.pending += seg.size();                        // account bytes
+            c.out.push_back(std::move(seg));                // queue segment
+        }
+        c.progress = Clock::now();                          // fresh deadline
+        if (c.pending > kEgressMaxPending) { evict(fd, "output backlog too large"); return; } // bound memory
+        flush(fd, c);                                       // fast path: usually completes here
+    }
+
+    // Write as much of c.out as the socket accepts. Finishes the connection when all is
+    // sent, arms EPOLLOUT when the socket is full, and evicts on a real error.
+    void flush(int fd, Conn& c) {                           // gather-write pending segments
+        while (!c.out.empty()) {                            // until drained or blocked
+            ssize_t k = send_some(fd, c.out, c.head);       // one gather write
+            if (k < 0) {                                    // nothing written
+                if (errno == EINTR) continue;               // retry
+                if (errno == EAGAIN || errno == EWOULDBLOCK) { arm(fd, c); return; } // wait for EPOLLOUT
+                evict(fd, std::strerror(errno));            // broken connection: report, don't drop silently
+                return;                                     // fd closed
+            }
+            c.progress = Clock::now();                      // client is reading
+            c.pending -= (std::size_t)k;                    // account
+        }
+        finish(fd);                                         // reply complete
+    }
+
+    // One sendmsg() over up to kEgressMaxIov queued segments (the first `head` bytes of
+    // out.front() are already sent). Retires what was written; returns sendmsg()'s result.
+    static ssize_t send_some(int fd, std::deque<std::string>& out, std::size_t& head) {
+        iovec iov[kEgressMaxIov];                           // gather list
+        int cnt = 0;                                        // used entries
+        for (auto it = out.begin(); it != out.end() && cnt < kEgressMaxIov; ++it, ++cnt) {
+            const std::size_t off = (cnt == 0) ? head : 0;  // skip bytes already sent
+            iov[cnt].iov_base = const_cast<char*>(it->data()) + off; // segment start
+            iov[cnt].iov_len  = it->size() - off;           // segment remainder
+        }
+        msghdr m{}; m.msg_iov = iov; m.msg_iovlen = (std::size_t)cnt; // writev via sendmsg
+        ssize_t k = ::sendmsg(fd, &m, MSG_NOSIGNAL);        // no SIGPIPE on a closed peer
+        std::size_t left = k > 0 ? (std::size_t)k : 0;      // bytes to retire
+        while (left) {                                      // pop fully sent segments
+            const std::size_t rem = out.front().size() - head; // unsent part of front
+            if (left < rem) { head += left; break; }        // partial segment
+            left -= rem; head = 0; out.pop_front();         // whole segment sent
+        }
+        return k;                                           // bytes written or -1 (errno set)
+    }
+
+    void arm(int fd, Conn& c) {                             // wait for the socket to drain
+        if (c.armed) return;                                // already registered
+        epoll_event ev{}; ev.events = EPOLLOUT; ev.data.fd = fd; // writable readiness
+        if (::epoll_ctl(ep_, EPOLL_CTL_ADD, fd, &ev) < 0) { evict(fd, std::strerror(errno)); return; } // cannot watch
+        c.armed = true;                                     // mark registered
+    }
+
+    void finish(int fd) {                                   // all bytes sent: close like before
+        release(fd);                                        // forget + deregister
+        ::shutdown(fd, SHUT_RDWR);                          // shutdown socket
+        ::close(fd);                                        // close socket
+    }
+
+    void evict(int fd, const char* why) {                   // give up on a client
+        auto it = conns_.find(fd);                          // pending bytes for the log
+        const std::size_t lost = (it == conns_.end()) ? 0 : it->second.pending;
+        std::cerr << "[egress] dropping fd " << fd << " (" << why << "), "
+                  << lost << " unsent bytes\n";             // never drop silently
+        release(fd);                                        // forget + deregister
+        ::close(fd);                                        // close socket (RST if unread data)
+    }
+
+    void release(int fd) {                                  // remove reactor state for fd
+        auto it = conns_.find(fd);                          // lookup
+        if (it == conns_.end()) return;                     // unknown
+        if (it->second.armed) ::epoll_ctl(ep_, EPOLL_CTL_DEL, fd, nullptr); // stop watching
+        conns_.erase(it);                                   // drop buffers
+    }
+
+    int ep_;                                                // epoll instance
+    int wake_;                                              // eventfd doorbell
+    std::mutex mu_;                                         // protects inbox_/stopping_
+    std::vector<Response> inbox_;                           // replies posted by other stages
+    bool stopping_ = false;                                 // stop requested
+    std::unordered_map<int, Conn> conns_;                   // reactor-thread-only state
+    std::thread th_;                                        // reactor thread (started last)
+};
+
+// -------- Stage 0: Ingress reactor (non-blocking accept + framing) --------
+// One epoll loop accepts every connection and reads whatever bytes are available into
+// that connection's framing buffer. A complete line leaves the reactor: small requests
+// (fits_inline) are answered right here, run to completion; the rest become a ClientMsg
+// for the staged pipeline. Idle deadlines
+// live in a hashed timer wheel: activity only moves the deadline stored on the
+// connection; the wheel entry is re-filed lazily when its slot comes up, so a silent
+// client costs no thread time and no per-byte timer work.
+class IngressStage {                                        // ingress AO (epoll reactor)
+public:
+    IngressStage(BlockingQueue<ClientMsg>& out, EgressStage& egress) // ctor wires outputs
+      : out_(out), egress_(egress),
+        ep_(::epoll_create1(EPOLL_CLOEXEC)),                // readiness set
+        wheel_(kIngressWheelSlots), start_(Clock::now()),   // empty wheel, tick 0 = now
+        th_() {
+        g_wake_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC); // SIGINT doorbell
+        watch(g_wake_fd);                                   // wake on stop
+        watch(g_listen_fd);                                 // wake on new connections
+        th_ = std::thread([this]{ run(); });                // start reactor thread
+    }
+    ~IngressStage() { join(); ::close(ep_); }               // release epoll fd
+
+    void join() { if (th_.joinable()) th_.join(); }         // returns once g_stop is set
+    std::thread& thread() { return th_; }                   // for CPU placement
+
+private:
+    using Clock = std::chrono::steady_clock;                // monotonic clock for ticks
+
+    struct Conn {                                           // per-connection framing state
+        std::string buf;                                    // bytes received so far
+        uint64_t    serial;                                 // distinguishes reused fd numbers
+        uint64_t    deadline;                               // idle deadline (in ticks)
+    };
+    struct Timer { int fd; uint64_t serial; };              // wheel entry
+
+    void watch(int fd) {                                    // add fd for EPOLLIN
+        epoll_event ev{}; ev.events = EPOLLIN; ev.data.fd = fd; // readable readiness
+        ::epoll_ctl(ep_, EPOLL_CTL_ADD, fd, &ev);           // register
+    }
+
+    uint64_t now_tick() const {                             // ticks since start
+        return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+                   Clock::now() - start_).count() / kIngressTickMs;
+    }
+
+    void schedule(int fd, const Conn& c) {                  // file a deadline in its slot
+        wheel_[c.deadline & (kIngressWheelSlots - 1)].push_back(Timer{ fd, c.serial }); // hashed by tick
+    }
+
+    void run() {                                            // thread body
+        std::vector<epoll_event> evs(64);                   // ready list
+        while (!g_stop.load()) {                            // reactor loop
+            const int timeout = conns_.empty() ? -1 : kIngressTickMs; // tick only while clients wait
+            int n = ::epoll_wait(ep_, evs.data(), (int)evs.size(), timeout); // wait for readiness
+            if (n < 0 && errno != EINTR) { std::perror("epoll_wait"); break; } // fatal reactor error
+            for (int i = 0; i < n; ++i) {                   // handle ready fds
+                const int fd = evs[i].data.fd;              // which fd
+                if (fd == g_wake_fd) continue;              // stop flag is checked by the loop
+                if (fd == g_listen_fd) { accept_all(); continue; } // new connections
+                on_readable(fd);                            // client bytes (or EOF/error)
+            }
+            out_.push_many(ready_);                         // every line framed this round, one lock
+            expire(now_tick());                             // advance the timer wheel
+        }
+        for (auto& kv : conns_) ::close(kv.first);          // drop half-read requests on shutdown
+        conns_.clear();                                     // forget them
+        close_listen_fd();                                  // stop accepting
+        ::close(g_wake_fd); g_wake_fd = -1;                 // doorbell no longer needed
+    }
+
+    void accept_all() {                                     // drain the accept queue
+        for (;;) {                                          // until EAGAIN
+            int cfd = ::accept4(g_listen_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC); // non-blocking client
+            if (cfd < 0) {                                  // nothing (more) to accept
+                if (errno == EINTR || errno == ECONNABORTED) continue; // transient
+                if (errno != EAGAIN && errno != EWOULDBLOCK) std::perror("accept4"); // e.g. EMFILE
+                return;                                     // back to epoll
+            }
+            Conn& c = conns_[cfd];                          // fresh state
+            c.buf.clear();                                  // (map slot may be reused)
+            c.serial   = ++serial_;                         // unique per connection
+            c.deadline = now_tick() + kIngressIdleMs / kIngressTickMs; // idle deadline
+            schedule(cfd, c);                               // arm idle timer
+            watch(cfd);                                     // wait for its request
+        }
+    }
+
+    void on_readable(int fd) {                              // read what is there, frame lines
+        auto it = conns_.find(fd);                          // connection state
+        if (it == conns_.end()) return;                     // already handed off/closed
+        Conn& c = it->second;                               // shorthand
+        char buf[kBufSz];                                   // recv chunk
+        bool eof = false;                                   // peer finished sending
+        for (;;) {                                          // until EAGAIN
+            ssize_t n = ::recv(fd, buf, sizeof(buf), 0);    // non-blocking read
+            if (n > 0) { c.buf.append(buf, (std::size_t)n); if (c.buf.size() > kMaxLineBytes) break; continue; } // buffer it
+            if (n == 0) { eof = true; break; }              // orderly EOF
+            if (errno == EINTR) continue;                   // retry
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break; // drained for now
+            drop(fd); return;                               // reset / error
+        }
+
+        const auto nl = c.buf.find('\n');                   // complete request line?
+        if (nl == std::string::npos && c.buf.size() > kMaxLineBytes) { // no line within limit
+            handoff(fd);                                    // egress owns the fd now
+            egress_.post(Response{ fd, { "Error: request line too long\n" }, 0 }); // explain and close
+            return;                                         // done with this client
+        }
+        if (nl == std::string::npos && !eof) {              // partial line: wait for more
+            c.deadline = now_tick() + kIngressIdleMs / kIngressTickMs; // activity resets idle clock
+            return;                                         // wheel entry is re-filed lazily
+        }
+        if (nl == std::string::npos && c.buf.empty()) { drop(fd); return; } // EOF with nothing sent
+
+        std::string line = (nl == std::string::npos) ? std::move(c.buf) : c.buf.substr(0, nl); // one line per connection
+        while (!line.empty() && (line.back()=='\n' || line.back()=='\r')) line.pop_back(); // strip CR/LF
+        handoff(fd);                                        // leaves the reactor either way
+        if (fits_inline(line)) {                            // small: zero handoffs
+            egress_.send_inline(fd, run_to_completion(line)); // compute + write right here
+            return;                                         // done
+        }
+        ready_.push_back(ClientMsg{ fd, std::move(line), next_id_++ }); // large: parser gets it after this round
+    }
+
+    void expire(uint64_t now) {                             // run every slot up to `now`
+        for (; tick_ <= now; ++tick_) {                     // catch up missed ticks
+            auto& slot = wheel_[tick_ & (kIngressWheelSlots - 1)]; // slot for this tick
+            if (slot.empty()) continue;                     // nothing filed here
+            std::vector<Timer> due; due.swap(slot);         // re-filing may append to this slot
+            for (const Timer& t : due) {                    // check each entry
+                auto it = conns_.find(t.fd);                // still waiting?
+                if (it == conns_.end() || it->second.serial != t.serial) continue; // stale entry
+                if (it->second.deadline > tick_) { schedule(t.fd, it->second); continue; } // later lap/extended
+                drop(t.fd);                                 // idle too long
+            }
+        }
+    }
+
+    void handoff(int fd) {                                  // stop watching, keep socket open
+        ::epoll_ctl(ep_, EPOLL_CTL_DEL, fd, nullptr);       // no more reads here
+        conns_.erase(fd);                                   // wheel entry goes stale
+    }
+
+    void drop(int fd) {                                     // close a client that sent no request
+        handoff(fd);                                        // forget it
+        ::close(fd);                                        // close socket
+    }
+
+    BlockingQueue<ClientMsg>& out_;                         // parser input
+    EgressStage&              egress_;                      // inline replies + framing errors
+    int                       ep_;                          // epoll instance
+    std::vector<std::vector<Timer>> wheel_;                 // hashed timer wheel
+    Clock::time_point         start_;                       // tick 0
+    uint64_t                  tick_ = 0;                    // next tick to process
+    uint64_t                  serial_ = 0;                  // connection counter
+    ReqId                     next_id_ = 1;                 // monotonic request id
+    std::vector<ClientMsg>    ready_;                       // complete requests of this epoll round
+    std::unordered_map<int, Conn> conns_;                   // reactor-thread-only state
+    std::thread th_;                                        // reactor thread (started last)
 };
 
 // -------- Stage 2: Dispatcher (fan-out to 4 algorithm queues) --------
+// Defined before the parser, which calls dispatch() directly when the two are fused.
 class DispatcherStage {                                     // dispatcher AO
 public:
+    // With threaded == false no thread is started: the parser calls dispatch() itself
+    // (parser+dispatcher fusion), saving one hop per request.
     DispatcherStage(BlockingQueue<GraphJob>& in,            // ctor with all queues
                     BlockingQueue<AlgoTask>& q_mst,
                     BlockingQueue<AlgoTask>& q_scc,
                     BlockingQueue<AlgoTask>& q_maxflow,
                     BlockingQueue<AlgoTask>& q_hamilton,
-                    BlockingQueue<AlgoResult>& q_agg_start)
+                    BlockingQueue<AlgoResult>& q_agg_start,
+                    bool threaded = true)
       : in_(in), q_mst_(q_mst), q_scc_(q_scc), q_max_(q_maxflow), q_ham_(q_hamilton),
-        q_agg_(q_agg_start), th_([this]{ run(); }) {}       // start thread
+        q_agg_(q_agg_start), th_() {
+        if (threaded) th_ = std::thread([this]{ run(); });  // start thread
+    }
 
     void join() { if (th_.joinable()) th_.join(); }         // join on shutdown
+    std::thread& thread() { return th_; }                   // for CPU placement
+
+    // Fan a batch out to the aggregator and the four workers; `batch` is consumed.
+    // Thread-safe (scratch is per call), so every fused parser may call it.
+    void dispatch(std::vector<GraphJob>& batch) {           // fan-out
+        std::vector<AlgoResult> begins;                     // BEGIN sentinels of this batch
+        std::vector<AlgoTask>   mst, scc, mfl, ham;         // per-worker task batches
+        for (auto& gj : batch) {                            // fan out each job
+            // Tell aggregator a new request is coming (so it knows the label & expects 4 results).
+            begins.push_back(AlgoResult{ gj.client_fd, "BEGIN", "", gj.label, gj.id }); // BEGIN sentinel
+
+            // fan out to the four algorithm workers
+            mst.push_back(AlgoTask{ gj.client_fd, gj.g, AlgorithmId::Mst,      gj.label, gj.id }); // MST task
+            scc.push_back(AlgoTask{ gj.client_fd, gj.g, AlgorithmId::Scc,      gj.label, gj.id }); // SCC task
+            mfl.push_back(AlgoTask{ gj.client_fd, gj.g, AlgorithmId::MaxFlow,  gj.label, gj.id }); // MaxFlow task
+            ham.push_back(AlgoTask{ gj.client_fd, gj.g, AlgorithmId::Hamilton, gj.label, gj.id }); // Hamilton task
+        }
+        batch.clear();                                      // jobs consumed
+        q_agg_.push_many(begins);                           // sentinels first: they precede any result
+        q_mst_.push_many(mst); q_scc_.push_many(scc);       // one lock per worker queue
+        q_max_.push_many(mfl); q_ham_.push_many(ham);       // ...
+    }
 
 private:
     void run() {                                            // thread body
+        std::vector<GraphJob> batch;                        // drained input
         while (!g_stop.load()) {                            // loop
-            auto gj = in_.pop();                            // pop a graph job
-            if (!gj) break;                                 // drained
-            // Tell aggregator a new request is coming (so it knows the label & expects 4 results).
-            q_agg_.push(AlgoResult{ gj->client_fd, "BEGIN", "", gj->label, gj->id }); // BEGIN sentinel
-
-            // fan out to the four algorithm workers
-            q_mst_.push(     AlgoTask{ gj->client_fd, gj->g, "MST",      gj->label, gj->id }); // MST task
-            q_scc_.push(     AlgoTask{ gj->client_fd, gj->g, "SCC",      gj->label, gj->id }); // SCC task
-            q_max_.push(     AlgoTask{ gj->client_fd, gj->g, "MAXFLOW",  gj->label, gj->id }); // MaxFlow task
-            q_ham_.push(     AlgoTask{ gj->client_fd, gj->g, "HAMILTON", gj->label, gj->id }); // Hamilton task
+            if (!in_.pop_many(batch, g_batch)) break;       // drained
+            dispatch(batch);                                // fan out
         }
     }
 
@@ -323,6 +890,46 @@ private:
     BlockingQueue<AlgoTask>& q_max_;                        // MAXFLOW queue
     BlockingQueue<AlgoTask>& q_ham_;                        // HAMILTON queue
     BlockingQueue<AlgoResult>& q_agg_;                      // aggregator input
+    std::thread th_;                                        // worker thread (unless fused)
+};
+
+// -------- Stage 1: Parse + Build Graph --------
+class ParserStage {                                         // parser AO
+public:
+    // `fused` != nullptr: fan out through fused->dispatch() instead of pushing to `out`.
+    ParserStage(BlockingQueue<ClientMsg>& in, BlockingQueue<GraphJob>& out, EgressStage& err,
+                DispatcherStage* fused = nullptr)           // ctor wires queues
+      : in_(in), out_(out), err_(err), fused_(fused), th_([this]{ run(); }) {} // spawn thread running run()
+
+    void join() { if (th_.joinable()) th_.join(); }         // join on shutdown
+    std::thread& thread() { return th_; }                   // for CPU placement
+
+private:
+    void run() {                                            // thread body
+        std::vector<ClientMsg> batch;                       // drained input
+        std::vector<GraphJob>  jobs;                        // built graphs of this batch
+        std::vector<Response>  errs;                        // error replies of this batch
+        while (!g_stop.load()) {                            // loop until stop
+            if (!in_.pop_many(batch, g_batch)) break;       // queue drained
+            for (auto& msg : batch) {                       // parse each message
+                Graph g; std::string err;                   // local graph + error
+                if (!build_graph_from_command(msg.line, g, err)) { // parse/build
+                    errs.push_back(Response{ msg.client_fd, { "Error: " + err + "\n" }, msg.id }); // egress sends + closes
+                    continue;                               // next item
+                }
+                auto sp = std::make_shared<Graph>(std::move(g)); // share graph
+                jobs.push_back(GraphJob{ msg.client_fd, sp, sp->label(), msg.id }); // build job
+            }
+            if (fused_) fused_->dispatch(jobs);             // fused: fan out on this thread
+            else        out_.push_many(jobs);               // push to next stage
+            err_.post_many(errs);                           // flush error replies
+        }
+    }
+
+    BlockingQueue<ClientMsg>& in_;                          // input queue
+    BlockingQueue<GraphJob>&  out_;                         // output queue
+    EgressStage&              err_;                         // error replies skip the pipeline
+    DispatcherStage*          fused_;                       // non-null when parser+dispatcher are fused
     std::thread th_;                                        // worker thread
 };
 
@@ -333,15 +940,21 @@ public:
       : name_(name), in_(in), out_(out), th_([this]{ run(); }) {} // spawn thread
 
     void join() { if (th_.joinable()) th_.join(); }         // join on shutdown
+    std::thread& thread() { return th_; }                   // for CPU placement
 
 private:
     void run() {                                            // thread body
+        std::vector<AlgoTask>   batch;                      // drained input
+        std::vector<AlgoResult> results;                    // results of this batch
         while (!g_stop.load()) {                            // loop
-            auto t = in_.pop();                             // pop a task
-            if (!t) break;                                  // drained
-            auto alg = AlgorithmFactory::create(t->algoName); // create strategy
-            std::string text = alg ? alg->run(*t->g) : "(unavailable)"; // run or fallback
-            out_.push(AlgoResult{ t->client_fd, t->algoName, text, t->label, t->id }); // push result
+            if (!in_.pop_many(batch, g_batch)) break;       // drained
+            for (auto& t : batch) {                         // same algorithm back to back (warm icache)
+                std::string text = AlgorithmFactory::run(t.algo, *t.g); // static dispatch, no allocation
+                const std::string name(AlgorithmFactory::name(t.algo)); // "MST", "SCC", ...
+                results.push_back(AlgoResult{ t.client_fd, name, std::move(text), t.label, t.id }); // collect result
+            }
+            batch.clear();                                  // release graphs before blocking again
+            out_.push_many(results);                        // push results
         }
     }
 
@@ -354,10 +967,11 @@ private:
 // -------- Stage 4: Aggregator (fan-in) --------
 class AggregatorStage {                                     // aggregator AO
 public:
-    AggregatorStage(BlockingQueue<AlgoResult>& in, BlockingQueue<Response>& out) // ctor
+    AggregatorStage(BlockingQueue<AlgoResult>& in, EgressStage& out) // ctor
       : in_(in), out_(out), th_([this]{ run(); }) {}        // spawn thread
 
     void join() { if (th_.joinable()) th_.join(); }         // join on shutdown
+    std::thread& thread() { return th_; }                   // for CPU placement
 
 private:
     struct State {                                          // per-request state
@@ -367,58 +981,39 @@ private:
     };
 
     void run() {                                            // thread body
+        std::vector<AlgoResult> batch;                      // drained input
+        std::vector<Response>   done;                       // replies completed by this batch
         while (!g_stop.load()) {                            // loop
-            auto r = in_.pop();                             // pop a result
-            if (!r) break;                                  // drained
-
-            auto& st = reqs_[r->id];                        // get/create state
-            if (r->algoName == "BEGIN") {                   // BEGIN sentinel?
-                st.client_fd = r->client_fd;                // record fd
-                st.label     = r->label;                    // record label
-                continue;                                   // wait for results
-            }
-
-            st.client_fd = r->client_fd;                    // update fd
-            st.label     = r->label;                        // update label
-            st.got[r->algoName] = r->text;                  // record this result
-
-            if (st.got.size() == 4) {                       // all four arrived?
-                std::ostringstream oss;                     // build response
-                oss << "Graph: " << st.label << "\n";       // header
-                oss << "MST: "      << st.got["MST"]      << "\n"; // MST line
-                oss << "SCC: "      << st.got["SCC"]      << "\n"; // SCC line
-                oss << "MAXFLOW: "  << st.got["MAXFLOW"]  << "\n"; // MaxFlow line
-                oss << "HAMILTON: " << st.got["HAMILTON"] << "\n"; // Hamilton line
-                out_.push(Response{ st.client_fd, oss.str(), /*id*/0 }); // enqueue response
-                reqs_.erase(r->id);                         // discard state
-            }
+            if (!in_.pop_many(batch, g_batch)) break;       // drained
+            for (auto& res : batch) fold(res, done);        // fold each result in
+            out_.post_many(done);                           // hand the whole batch to egress
         }
     }
 
-    BlockingQueue<AlgoResult>& in_;                         // input queue
-    BlockingQueue<Response>&   out_;                        // output queue
-    std::map<ReqId, State>     reqs_;                       // per-request map
-    std::thread th_;                                        // worker thread
-};
+    void fold(AlgoResult& r, std::vector<Response>& done) { // merge one result into its request
+        auto& st = reqs_[r.id];                             // get/create state
+        if (r.algoName == "BEGIN") {                        // BEGIN sentinel?
+            st.client_fd = r.client_fd;                     // record fd
+            st.label     = r.label;                         // record label
+            return;                                         // wait for results
+        }
 
-// -------- Stage 5: Sender --------
-class SenderStage {                                         // sender AO
-public:
-    SenderStage(BlockingQueue<Response>& in) : in_(in), th_([this]{ run(); }) {} // ctor + start
-    void join() { if (th_.joinable()) th_.join(); }         // join on shutdown
+        st.client_fd = r.client_fd;                         // update fd
+        st.label     = r.label;                             // update label
+        st.got[r.algoName] = std::move(r.text);             // record this result
 
-private:
-    void run() {                                            // thread body
-        while (!g_stop.load()) {                            // loop
-            auto r = in_.pop();                             // pop a response
-            if (!r) break;                                  // drained
-            send_all(r->client_fd, r->payload);             // send payload
-            ::shutdown(r->client_fd, SHUT_RDWR);            // shutdown socket
-            ::close(r->client_fd);                          // close socket
+        if (st.got.size() == 4) {                           // all four arrived?
+            done.push_back(Response{ st.client_fd,          // reply complete
+                                     reply_segments(st.label, std::move(st.got["MST"]), std::move(st.got["SCC"]),
+                                                    std::move(st.got["MAXFLOW"]), std::move(st.got["HAMILTON"])),
+                                     r.id });
+            reqs_.erase(r.id);                              // discard state
         }
     }
 
-    BlockingQueue<Response>& in_;                           // input queue
+    BlockingQueue<AlgoResult>& in_;                         // input queue
+    EgressStage&               out_;                        // egress reactor
+    std::map<ReqId, State>     reqs_;                       // per-request map
     std::thread th_;                                        // worker thread
 };
 
@@ -430,6 +1025,7 @@ static bool setup_listen() {                                // create/bind/liste
     g_listen_fd = ::socket(res->ai_family,res->ai_socktype,res->ai_protocol); // create socket
     if (g_listen_fd<0) { std::perror("socket"); freeaddrinfo(res); return false; } // check
     int yes=1; ::setsockopt(g_listen_fd,SOL_SOCKET,SO_REUSEADDR,&yes,sizeof(yes)); // reuse addr
+    ::fcntl(g_listen_fd, F_SETFL, ::fcntl(g_listen_fd, F_GETFL, 0) | O_NONBLOCK); // reactor accepts until EAGAIN
     if (::bind(g_listen_fd,res->ai_addr,res->ai_addrlen)<0) { std::perror("bind"); freeaddrinfo(res); close_listen_fd(); return false; } // bind
     if (::listen(g_listen_fd,kBacklog)<0) { std::perror("listen"); freeaddrinfo(res); close_listen_fd(); return false; } // listen
     freeaddrinfo(res);                                      // free addrinfo
@@ -437,51 +1033,69 @@ static bool setup_listen() {                                // create/bind/liste
 }
 
 // ============ main ============
-int main() {                                                // program entry
+int main(int argc, char** argv) {                           // program entry
+    for (int i = 1; i < argc; ++i) {                        // options
+        const std::string a = argv[i];                      // current flag
+        if (a == "--fuse") { g_fuse = true; continue; }     // parser+dispatcher on one thread
+        if (i + 1 < argc && a == "--batch") { g_batch = std::max<std::size_t>(1, std::strtoul(argv[++i], nullptr, 10)); continue; }
+        if (i + 1 < argc && a == "--inline-max") { g_inline_max_v = std::min<std::size_t>(kInlineMaxV, std::strtoul(argv[++i], nullptr, 10)); continue; }
+        if (i + 1 < argc && a == "--parsers") { g_parsers = std::max<std::size_t>(1, std::strtoul(argv[++i], nullptr, 10)); continue; }
+        if (i + 1 < argc && a == "--pin" && parse_pin(argv[++i])) continue; // thread placement
+        if (i + 1 < argc && a == "--mem") {                 // graph memory placement
+            try { MemoryPlacement::setGraphs(MemoryPlacement::parse(argv[++i])); continue; }
+            catch (const std::invalid_argument& e) { std::cerr << "--mem: " << e.what() << "\n"; }
+        }
+        if (i + 1 < argc && a == "--pages") {               // huge pages for big graph arrays
+            try { BigAlloc::setPolicy(BigAlloc::parse(argv[++i])); continue; }
+            catch (const std::invalid_argument& e) { std::cerr << "--pages: " << e.what() << "\n"; }
+        }
+        std::cerr << "Usage: " << argv[0] << " [--batch N] [--inline-max V] [--fuse] [--parsers P]"
+                  << " [--pin [STAGE=]SPEC]... [--mem SPEC] [--pages SPEC]\n"; // unknown flag
+        return 2;                                           // bad usage
+    }
     std::signal(SIGINT, on_sigint);                         // install SIGINT handler
 
     if (!setup_listen()) return 1;                          // setup server socket
-    std::cout << "[Pipeline server] listening on " << kIP << ":" << kPort << "\n"; // log
+    std::cout << "[Pipeline server] listening on " << kIP << ":" << kPort
+              << " (" << g_parsers << " parsers, stage batch " << g_batch << ", inline V<=" << g_inline_max_v
+              << (g_fuse ? ", parser+dispatcher fused" : "") << ")\n"; // log
+    const Topology& topo = Topology::system();              // NUMA nodes from sysfs
+    std::cout << "[Pipeline server] " << topo.cpuNodes() << " NUMA node(s), " << topo.cpus().size()
+              << " CPUs; pin " << g_pin_all.describe() << ", graph memory "
+              << MemoryPlacement::graphs().describe() << ", pages "
+              << BigAlloc::describe(BigAlloc::policy()) << "\n"; // placement log
+    if (g_pin_stage[kPinPool]) ThreadPool::shared().pin(*g_pin_stage[kPinPool]); // parallel kernels' helpers
 
     // Mailboxes
     BlockingQueue<ClientMsg>   q_in;                        // acceptor -> parser
     BlockingQueue<GraphJob>    q_graph;                     // parser -> dispatcher
     BlockingQueue<AlgoTask>    q_mst, q_scc, q_max, q_ham;  // dispatcher -> workers
     BlockingQueue<AlgoResult>  q_agg_in;                    // workers -> aggregator
-    BlockingQueue<Response>    q_send;                      // aggregator -> sender
 
     // Stages
-    ParserStage     stage_parse(q_in, q_graph);             // start parser AO
-    DispatcherStage stage_disp(q_graph, q_mst, q_scc, q_max, q_ham, q_agg_in); // start dispatcher AO
+    EgressStage     stage_send;                             // start egress reactor (first: others post to it)
+    DispatcherStage stage_disp(q_graph, q_mst, q_scc, q_max, q_ham, q_agg_in, !g_fuse); // dispatcher AO (no thread if fused)
+    std::vector<std::unique_ptr<ParserStage>> parsers;      // parser pool, all popping q_in
+    for (std::size_t i = 0; i < g_parsers; ++i)             // start parser AOs
+        parsers.push_back(std::make_unique<ParserStage>(q_in, q_graph, stage_send, g_fuse ? &stage_disp : nullptr));
     AlgoWorker      w_mst ("MST",      q_mst, q_agg_in);    // start MST AO
     AlgoWorker      w_scc ("SCC",      q_scc, q_agg_in);    // start SCC AO
     AlgoWorker      w_max ("MAXFLOW",  q_max, q_agg_in);    // start MAXFLOW AO
     AlgoWorker      w_ham ("HAMILTON", q_ham, q_agg_in);    // start HAMILTON AO
-    AggregatorStage stage_agg(q_agg_in, q_send);            // start aggregator AO
-    SenderStage     stage_send(q_send);                     // start sender AO
-
-    // Simple accept loop: read one command line per connection, enqueue to pipeline.
-    ReqId next_id = 1;                                      // monotonic request id
-    while (!g_stop.load()) {                                // accept loop
-        sockaddr_storage a{}; socklen_t alen=sizeof(a);     // client address
-        int cfd = ::accept(g_listen_fd,(sockaddr*)&a,&alen);// accept client
-        if (cfd < 0) {                                      // if failed
-            if (g_stop.load()) break;                       // exit on stop
-            // transient error; continue
-            continue;                                       // try again
-        }
-        // read one line
-        char buf[kBufSz];                                   // recv buffer
-        ssize_t n = ::recv(cfd, buf, sizeof(buf)-1, 0);     // receive data
-        if (n <= 0) { ::close(cfd); continue; }             // close on error/EOF
-        buf[n] = '\0';                                      // C-string terminate
-
-        std::string line(buf);                              // wrap as std::string
-        // Trim CR/LF
-        while (!line.empty() && (line.back()=='\n' || line.back()=='\r')) line.pop_back(); // strip CR/LF
+    AggregatorStage stage_agg(q_agg_in, stage_send);        // start aggregator AO
 
-        q_in.push(ClientMsg{ cfd, std::move(line), next_id++ }); // enqueue to parser
-    }
+    IngressStage    stage_in(q_in, stage_send);             // start ingress reactor (accept + framing)
+
+    // Placement in pipeline order, so "compact" keeps neighbouring stages on neighbouring CPUs.
+    place(stage_in.thread(), kPinIngress, 0);               // ingress reactor
+    for (std::size_t i = 0; i < parsers.size(); ++i)        // parser pool
+        place(parsers[i]->thread(), kPinParsers, (unsigned)i);
+    if (!g_fuse) place(stage_disp.thread(), kPinDispatcher, 0); // dispatcher (no thread when fused)
+    unsigned w = 0;                                         // worker index
+    for (AlgoWorker* wk : { &w_mst, &w_scc, &w_max, &w_ham }) place(wk->thread(), kPinWorkers, w++); // workers
+    place(stage_agg.thread(), kPinAggregator, 0);           // aggregator
+    place(stage_send.thread(), kPinEgress, 0);              // egress reactor
+    stage_in.join();                                        // runs until Ctrl+C
 
     // Shutdown: close listening socket and drain queues
     close_listen_fd();                                      // close listener
@@ -489,14 +1103,14 @@ int main() {                                                // program entry
     q_graph.close();                                        // ...
     q_mst.close(); q_scc.close(); q_max.close(); q_ham.close(); // close worker queues
     q_agg_in.close();                                       // close aggregator in
-    q_send.close();                                         // close sender in
 
     // Join stages
-    stage_parse.join();                                     // join parser
+    for (auto& p : parsers) p->join();                      // join parsers
     stage_disp.join();                                      // join dispatcher
     w_mst.join(); w_scc.join(); w_max.join(); w_ham.join(); // join workers
     stage_agg.join();                                       // join aggregator
-    stage_send.join();                                      // join sender
+    stage_send.stop();                                      // no more posts: flush and close
+    stage_send.join();                                      // join egress reactor
 
     return 0;                                               // done
 }
@@ -2,22 +2,47 @@
 // AlgorithmFactory.cpp
 // Implements four algorithms (Strategy pattern):
 //   * MST weight (Kruskal; undirected only; error if disconnected)
-//   * SCC count (Kosaraju; works best for directed graphs)
+//   * SCC count (Tarjan; optional condensation DAG + topological order)
 //   * Max flow (Edmonds–Karp) from 0 to n-1
-//   * Hamiltonian circuit existence (backtracking)
-// Exposes AlgorithmFactory::create(name) to instantiate a strategy.
+//   * Hamiltonian circuit existence (biconnectivity pre-check + backtracking)
+// plus wrappers around the standalone engines (PageRank, matching,
+// biconnectivity, reachability, min-cost flow, MS-BFS metrics,
+// betweenness, coloring, maximum clique, frontier-engine BFS and
+// components, min-plus shortest paths, ...).
+// Exposes AlgorithmFactory::create(name) to instantiate a strategy and
+// AlgorithmFactory::run(id, g) to run a registered one without allocating.
 // Defines/implements the factory.
 // ===============================================
 
 #include "../include/algo/GraphAlgorithm.hpp"    // Include the interface and factory declaration.
+#include "../include/algo/PageRank.hpp"          // PageRank engine
+#include "../include/algo/Matching.hpp"          // Hopcroft–Karp engine
+#include "../include/algo/Biconnected.hpp"       // bridges / cut vertices (also a Hamilton pre-check)
+#include "../include/algo/Scc.hpp"               // Tarjan SCC + condensation
+#include "../include/algo/Reachability.hpp"      // condensed closure / interval index
+#include "../include/algo/MinCostFlow.hpp"       // successive shortest paths
+#include "../include/algo/MultiSourceBfs.hpp"    // bit-parallel all-sources BFS
+#include "../include/algo/Betweenness.hpp"       // parallel / sampled Brandes
+#include "../include/algo/Coloring.hpp"          // DSatur / largest-first / Jones–Plassmann
+#include "../include/algo/MaxClique.hpp"         // bitset branch and bound
+#include "../include/algo/FrontierApps.hpp"      // vertexMap / edgeMap ports
+#include "../include/algo/ShortestPaths.hpp"     // min-plus SpMV / SpMSpV Bellman–Ford
+#include "../include/graph/BitMatrix.hpp"        // packed adjacency for dense graphs
+#include "../include/sys/BigAlloc.hpp"           // huge-page backed residual arrays
 #include <algorithm>                  // std::sort, std::minmax
-#include <cctype>                     // std::tolower for case-insensitive names
+#include <array>                      // static dispatch tables
+#include <cctype>                     // std::tolower / std::toupper for case-insensitive names
+#include <chrono>                     // clique search deadline
 #include <climits>                    // LLONG_MAX for max-flow bottleneck
+#include <iomanip>                    // std::setprecision for scores
+#include <limits>                     // unbounded min-cost flow amount
 #include <memory>                     // std::make_unique for factory
-#include <queue>                      // std::queue used by BFS in max-flow
+#include <numeric>                    // std::iota, std::accumulate
 #include <set>                        // std::set to dedupe edges
 #include <sstream>                    // std::ostringstream to build responses
+#include <stdexcept>                  // std::invalid_argument from min-cost flow
 #include <string>                     // std::string
+#include <tuple>                      // std::get on min-cost flow arcs
 #include <vector>                     // std::vector
 
 // ---------- helper: to-lower a string (safe cast to unsigned char) ----------
@@ -26,6 +51,39 @@ static std::string to_lower(std::string s) {                       // Copy input
     return s;                                                      // Return transformed string.
 }
 
+// ---------- helper: split "NAME a b", "NAME:a,b" or "NAME:k=v,flag" into tokens ----------
+static std::vector<std::string> split_spec(const std::string& spec) {
+    std::vector<std::string> toks;                                 // Output tokens.
+    std::string cur;                                               // Token being built.
+    for (char c : spec) {                                          // Separators: whitespace, ':' and ','.
+        if (std::isspace(static_cast<unsigned char>(c)) || c == ':' || c == ',') {
+            if (!cur.empty()) toks.push_back(std::move(cur));      // Flush finished token.
+            cur.clear();
+        } else {
+            cur += c;                                              // Extend token.
+        }
+    }
+    if (!cur.empty()) toks.push_back(std::move(cur));              // Flush trailing token.
+    return toks;
+}
+
+// ---------- helper: parse a whole token as a number (false on junk) ----------
+template <typename T>
+static bool parse_num(const std::string& s, T& out) {
+    std::istringstream iss(s);                                     // Stream over the token.
+    T v{};                                                         // Parsed value.
+    if (!(iss >> v) || !iss.eof()) return false;                   // Reject partial parses.
+    out = v;                                                       // Commit.
+    return true;
+}
+
+// ---------- helper: split "key=value" (value empty for bare flags) ----------
+static std::pair<std::string, std::string> split_kv(const std::string& tok) {
+    const auto eq = tok.find('=');                                 // Locate '='.
+    if (eq == std::string::npos) return { to_lower(tok), "" };     // Bare flag.
+    return { to_lower(tok.substr(0, eq)), tok.substr(eq + 1) };    // key, value.
+}
+
 // =====================================================
 // 1) MST weight (Kruskal) — undirected graphs only
 // =====================================================
@@ -36,6 +94,8 @@ struct AlgoMstWeight final : IGraphAlgorithm {                     // Concrete s
 
         const std::size_t n = g.n();                               // Number of vertices.
         if (n == 0) return "MST weight: 0 (empty graph).";         // Trivial case: empty graph has weight 0.
+        if (StrongComponents::of(g).count > 1)                     // Cached component labels (shared with SCC)
+            return "Graph is disconnected; MST does not exist.";   // reject before sorting any edge.
 
         struct Edge { int w; int u; int v; };                      // Simple record to hold (weight, u, v).
         std::vector<Edge> edges;                                   // Container for unique undirected edges.
@@ -90,123 +150,164 @@ struct AlgoMstWeight final : IGraphAlgorithm {                     // Concrete s
 };
 
 // ================================================
-// 2) SCC count (Kosaraju) — for directed graphs
+// 2) SCC count (Tarjan; works best for directed graphs)
+//    Spec: SCC       → count only
+//          SCC:dag   → also component ids, condensation DAG, topological order
 // ================================================
 struct AlgoSccCount final : IGraphAlgorithm {                       // Concrete strategy type.
+    explicit AlgoSccCount(bool dag = false) : withDag(dag) {}       // Opt-in richer output.
+
     std::string run(const Graph& g) override {                      // Main entry for SCC counting.
         const std::size_t n = g.n();                                // Number of vertices.
         if (n == 0) return "SCC count: 0 (empty graph).";           // Trivial for empty graph.
 
-        std::vector<char> seen(n, 0);                               // Visited flags for first DFS.
-        std::vector<Graph::Vertex> order; order.reserve(n);         // Finish order list.
-
-        auto dfs1 = [&](auto&& self, Graph::Vertex u) -> void {     // First pass DFS (on g).
-            seen[u] = 1;                                            // Mark as visited.
-            for (const auto& e : g.adj(u)) {                        // For each edge u→v…
-                Graph::Vertex v = e.first;                          // Extract neighbor.
-                if (!seen[v]) self(self, v);                        // Recurse if not seen.
-            }
-            order.push_back(u);                                     // Record vertex by finish time.
-        };
-
-        for (Graph::Vertex u = 0; u < n; ++u)                       // Start DFS from every unvisited vertex.
-            if (!seen[u]) dfs1(dfs1, u);                            // Recurse.
-
-        Graph gr = g.reversed();                                    // Reverse the graph for second pass.
-        std::fill(seen.begin(), seen.end(), 0);                     // Reset visited flags.
-        std::size_t comps = 0;                                      // Component counter.
-
-        auto dfs2 = [&](auto&& self, Graph::Vertex u) -> void {     // Second pass DFS (on reversed graph).
-            seen[u] = 1;                                            // Mark visited.
-            for (const auto& e : gr.adj(u)) {                       // For each reverse edge u→v…
-                Graph::Vertex v = e.first;                          // Extract neighbor.
-                if (!seen[v]) self(self, v);                        // Recurse if not seen.
-            }
-        };
+        if (!withDag)                                               // Labels are shared via the graph's cache.
+            return "SCC count: " + std::to_string(StrongComponents::of(g).count) + ".";
 
-        for (std::size_t i = 0; i < n; ++i) {                       // Process vertices in reverse finish order.
-            Graph::Vertex u = order[n - 1 - i];                     // Take from the end of order.
-            if (!seen[u]) {                                         // If this root not seen…
-                ++comps;                                            // …we found a new SCC.
-                dfs2(dfs2, u);                                      // Mark entire component.
-            }
-        }
+        StrongComponents::Options o; o.condensation = true;         // Condense in the same pass.
+        const auto r = StrongComponents(o).compute(g);              // One Tarjan pass.
 
         std::ostringstream oss;                                     // Build message.
-        oss << "SCC count: " << comps << ".";                       // Include count.
+        oss << "SCC count: " << r.count << ".";                     // Include count.
+
+        oss << " Components: [";                                    // Component id per vertex.
+        for (std::size_t v = 0; v < n; ++v) oss << (v ? " " : "") << r.component[v];
+        oss << "]; condensation DAG (" << r.dagArcs() << " arcs):"; // Deduplicated inter-SCC arcs.
+        for (std::size_t c = 0; c < r.count; ++c)
+            for (std::size_t p = r.dagOffsets[c]; p < r.dagOffsets[c + 1]; ++p)
+                oss << " " << c << "->" << r.dagTargets[p];
+        oss << "; topological order:";                              // Sources first.
+        for (std::size_t c : r.topoOrder) oss << " " << c;
+        oss << ".";
         return oss.str();                                           // Return.
     }
+
+    bool withDag;                                                   // Emit the condensation too.
 };
 
 // ==========================================================
 // 3) Max flow (Edmonds–Karp) from source 0 to sink n-1
+//    Dense graphs keep the residual network as one flat n×n capacity array
+//    plus a packed "capacity left" bit matrix, so BFS expands a vertex with
+//    one row kernel (row & ~visited); sparse graphs use paired residual arcs.
 // ==========================================================
 struct AlgoMaxFlow final : IGraphAlgorithm {                         // Concrete strategy type.
     std::string run(const Graph& g) override {                       // Entry point for max flow.
         const std::size_t n = g.n();                                 // Number of vertices.
         if (n < 2) return "Max flow: 0 (need at least two vertices)."; // Need source and sink.
 
-        std::vector<std::vector<long long>> cap(                     // Residual capacity matrix.
-            n, std::vector<long long>(n, 0));                        // Initialize all capacities to zero.
+        const long long flow = BitMatrix::preferred(g) ? dense(g) : sparse(g); // Pick the representation.
+
+        std::ostringstream oss;                                      // Build output string.
+        oss << "Max flow (0 -> " << (n - 1) << "): " << flow << "."; // Include source/sink in message.
+        return oss.str();                                            // Return.
+    }
+
+private:
+    // Capacity of one arc: its weight, or 1 for unweighted arcs.
+    static long long capacity(Graph::Weight w) { return w ? static_cast<long long>(w) : 1LL; }
 
-        for (Graph::Vertex u = 0; u < n; ++u) {                 // for each vertex u
-            for (const auto& e : g.adj(u)) {                    // for each outgoing edge u->v
-                Graph::Vertex v = e.first;                      // neighbor vertex id
-                long long w = e.second ? static_cast<long long>(e.second) : 1LL;
-                cap[u][v] += w;                                 // add forward capacity
+    static long long dense(const Graph& g) {
+        const std::size_t n = g.n();
+        BigArray<long long> cap(n * n, 0);                           // Residual capacity, row-major (huge pages).
+        for (Graph::Vertex u = 0; u < n; ++u)                        // Undirected graphs list both directions,
+            for (const auto& e : g.adj(u))                           // so no explicit mirroring is needed.
+                cap[u * n + e.first] += capacity(e.second);
 
-                // IMPORTANT: do NOT mirror for undirected graphs here.
-                // Your Graph exposes undirected edges in BOTH adjacency lists,
-                // so when the outer loop reaches 'v', you'll naturally add cap[v][u].
-            }
-        }
+        BitMatrix open(n, n);                                        // Bit (u,v) set iff cap[u][v] > 0.
+        for (Graph::Vertex u = 0; u < n; ++u)
+            for (const auto& e : g.adj(u))
+                if (cap[u * n + e.first] > 0) open.set(u, e.first);
 
-        Graph::Vertex s = 0;                                         // Source is node 0.
-        Graph::Vertex t = static_cast<Graph::Vertex>(n - 1);         // Sink is node n-1.
+        const std::size_t W = open.words();
+        BitMatrix scratch(2, n);                                     // Row 0: visited, row 1: candidates.
+        BitMatrix::Word* seen = scratch.row(0);
+        BitMatrix::Word* cand = scratch.row(1);
+        const Graph::Vertex s = 0, t = n - 1;                        // Source and sink.
+        std::vector<Graph::Vertex> parent(n), queue; queue.reserve(n);
         long long flow = 0;                                          // Accumulated max flow.
 
         while (true) {                                               // Repeat until no augmenting path exists.
-            std::vector<int> parent(n, -1);                          // To reconstruct path.
-            std::queue<Graph::Vertex> q;                             // BFS queue.
-            parent[s] = static_cast<int>(s);                         // Mark source as visited (parent to itself).
-            q.push(s);                                               // Start BFS from source.
-
-            while (!q.empty() && parent[t] == -1) {                  // While sink not reached…
-                Graph::Vertex u = q.front(); q.pop();                // Pop next vertex.
-                for (Graph::Vertex v = 0; v < n; ++v) {              // Examine all possible neighbors.
-                    if (parent[v] == -1 && cap[u][v] > 0) {          // If residual capacity exists and v not visited…
-                        parent[v] = static_cast<int>(u);             // Record predecessor on path.
-                        q.push(v);                                   // Enqueue v.
-                        if (v == t) break;                           // Early exit if we reached sink.
-                    }
+            std::fill(seen, seen + W, 0);
+            scratch.set(0, s);
+            queue.assign(1, s);
+            bool reached = false;
+            for (std::size_t head = 0; head < queue.size() && !reached; ++head) {
+                const Graph::Vertex u = queue[head];
+                BitMatrix::andNotRows(cand, open.row(u), seen, W);   // Unvisited vertices with capacity left.
+                for (std::size_t v = BitMatrix::nextSet(cand, W, 0); v != BitMatrix::npos;
+                     v = BitMatrix::nextSet(cand, W, v + 1)) {
+                    parent[v] = u;
+                    scratch.set(0, v);
+                    queue.push_back(v);
+                    if (v == t) { reached = true; break; }           // Early exit once the sink is reached.
                 }
             }
-
-            if (parent[t] == -1) break;                              // No augmenting path → we’re done.
+            if (!reached) break;                                     // No augmenting path → we’re done.
 
             long long add = LLONG_MAX;                               // Bottleneck capacity along the path.
-            for (int v = static_cast<int>(t); v != static_cast<int>(s); v = parent[v]) { // Walk back sink→source.
-                int u = parent[v];                                   // Predecessor on path.
-                add = std::min(add, cap[u][v]);                      // Take minimum residual capacity.
-            }
+            for (Graph::Vertex v = t; v != s; v = parent[v]) add = std::min(add, cap[parent[v] * n + v]);
 
-            for (int v = static_cast<int>(t); v != static_cast<int>(s); v = parent[v]) { // Update residual graph.
-                int u = parent[v];                                   // Predecessor.
-                cap[u][v] -= add;                                    // Reduce forward capacity.
-                cap[v][u] += add;                                    // Increase backward capacity.
+            for (Graph::Vertex v = t; v != s; v = parent[v]) {       // Update residual graph.
+                const Graph::Vertex u = parent[v];
+                if ((cap[u * n + v] -= add) <= 0) open.reset(u, v);  // Forward arc saturated.
+                if ((cap[v * n + u] += add) > 0)  open.set(v, u);    // Backward arc gains capacity.
             }
-
             flow += add;                                             // Increase total max flow.
         }
+        return flow;
+    }
 
-        std::ostringstream oss;                                      // Build output string.
-        oss << "Max flow (0 -> " << (n - 1) << "): " << flow << "."; // Include source/sink in message.
-        return oss.str();                                            // Return.
+    static long long sparse(const Graph& g) {
+        const std::size_t n = g.n();
+        struct Arc { Graph::Vertex to; long long cap; };             // Arc i's residual twin is i ^ 1.
+        BigArray<Arc> arcs;                                          // Huge pages once large.
+        std::vector<std::vector<std::size_t>> out(n);                // Residual arcs leaving each vertex.
+        for (Graph::Vertex u = 0; u < n; ++u)
+            for (const auto& e : g.adj(u)) {
+                out[u].push_back(arcs.size());       arcs.push_back({e.first, capacity(e.second)});
+                out[e.first].push_back(arcs.size()); arcs.push_back({u, 0});
+            }
+
+        const Graph::Vertex s = 0, t = n - 1;                        // Source and sink.
+        constexpr std::size_t none = static_cast<std::size_t>(-1);
+        std::vector<std::size_t> via(n);                             // Arc used to reach each vertex.
+        std::vector<Graph::Vertex> queue; queue.reserve(n);
+        long long flow = 0;                                          // Accumulated max flow.
+
+        while (true) {
+            std::fill(via.begin(), via.end(), none);
+            via[s] = arcs.size();                                    // Any non-"none" value marks the source.
+            queue.assign(1, s);
+            for (std::size_t head = 0; head < queue.size() && via[t] == none; ++head) {
+                const Graph::Vertex u = queue[head];
+                for (const std::size_t a : out[u]) {
+                    const Graph::Vertex v = arcs[a].to;
+                    if (via[v] != none || arcs[a].cap <= 0) continue;
+                    via[v] = a;
+                    queue.push_back(v);
+                    if (v == t) break;
+                }
+            }
+            if (via[t] == none) break;
+
+            long long add = LLONG_MAX;
+            for (Graph::Vertex v = t; v != s; v = arcs[via[v] ^ 1].to) add = std::min(add, arcs[via[v]].cap);
+            for (Graph::Vertex v = t; v != s; v = arcs[via[v] ^ 1].to) {
+                arcs[via[v]].cap -= add;
+                arcs[via[v] ^ 1].cap += add;
+            }
+            flow += add;
+        }
+        return flow;
     }
 };
 
 // ==================================================================
 // 4) Hamiltonian circuit (cycle) existence via backtracking
+//    Candidates are tried in ascending vertex order. Dense graphs read them
+//    from the shared packed adjacency matrix (row & ~used, one word at a
+//    time); sparse graphs from sorted, deduplicated neighbor lists.
 // ==================================================================
 struct AlgoHamilton final : IGraphAlgorithm {                         // Concrete strategy type.
     std::string run(const Graph& g) override {                        // Entry point for Hamiltonian cycle.
@@ -214,47 +315,21 @@ struct AlgoHamilton final : IGraphAlgorithm {                         // Concret
         if (n == 0) return "Hamiltonian circuit: trivial (empty).";   // Empty graph message.
         if (n == 1) return "Hamiltonian circuit: 0 -> 0";             // Single node cycle.
 
-        std::vector<std::vector<char>> A(                              // Adjacency matrix for O(1) checks.
-            n, std::vector<char>(n, 0));                               // Initialize to no edges.
-
-        for (Graph::Vertex u = 0; u < n; ++u) {                        // For each vertex…
-            for (const auto& e : g.adj(u)) {                           // …scan adjacency list.
-                Graph::Vertex v = e.first;                             // Neighbor vertex id.
-                A[u][v] = 1;                                           // Directed arc u→v exists.
-                if (!g.directed()) A[v][u] = 1;                        // Mirror for undirected graphs.
+        if (n >= 3) {                                                  // O(V+E) rejection before exponential search:
+            const auto bc = Biconnectivity().compute(g);               // a Hamiltonian cycle is also a cycle of the
+            if (bc.components > 1)                                     // underlying undirected graph, which must
+                return "No Hamiltonian circuit (graph is disconnected)."; // therefore be connected and cut-free.
+            if (!bc.articulationPoints.empty()) {
+                std::ostringstream oss;
+                oss << "No Hamiltonian circuit (vertex " << bc.articulationPoints.front()
+                    << " is an articulation point).";
+                return oss.str();
             }
         }
 
         std::vector<Graph::Vertex> path; path.reserve(n + 1);          // Sequence of vertices forming the cycle.
-        std::vector<char> used(n, 0);                                  // Visited flags for path.
-        Graph::Vertex start = 0;                                       // Start at vertex 0 (convention).
-        path.push_back(start);                                         // Put start in the path.
-        used[start] = 1;                                               // Mark start as used.
-
-        bool found = false;                                            // Flag to stop early once found.
-
-        auto dfs = [&](auto&& self, Graph::Vertex u) -> void {         // Backtracking DFS.
-            if (found) return;                                         // Stop recursion if already found.
-            if (path.size() == n) {                                    // If we placed all vertices…
-                if (A[u][start]) {                                     // …and there is an edge back to start…
-                    path.push_back(start);                              // …close the cycle.
-                    found = true;                                      // Mark success.
-                }
-                return;                                                // Return regardless.
-            }
-            for (Graph::Vertex v = 0; v < n; ++v) {                    // Try all possible next vertices.
-                if (!used[v] && A[u][v]) {                             // Must be unused and adjacent.
-                    used[v] = 1;                                       // Mark as used.
-                    path.push_back(v);                                 // Extend path.
-                    self(self, v);                                     // Recurse deeper.
-                    if (found) return;                                 // If found, bubble out.
-                    path.pop_back();                                   // Otherwise, undo choice.
-                    used[v] = 0;                                       // Unmark to try others.
-                }
-            }
-        };
-
-        dfs(dfs, start);                                               // Start DFS from start vertex.
+        path.push_back(0);                                             // Start at vertex 0 (convention).
+        const bool found = BitMatrix::preferred(g) ? dense(g, path) : sparse(g, path);
 
         if (!found) return "No Hamiltonian circuit.";                  // Report if none found.
 
@@ -266,17 +341,792 @@ struct AlgoHamilton final : IGraphAlgorithm {                         // Concret
         }
         return oss.str();                                              // Return message.
     }
+
+private:
+    static bool dense(const Graph& g, std::vector<Graph::Vertex>& path) {
+        const std::size_t n = g.n();
+        const BitMatrix& A = BitMatrix::of(g);                         // Shared packed adjacency.
+        const std::size_t W = A.words();
+        BitMatrix usedRow(1, n);                                       // Vertices already on the path.
+        BitMatrix::Word* used = usedRow.row(0);
+        const Graph::Vertex start = path.front();
+        usedRow.set(0, start);
+
+        auto dfs = [&](auto&& self, Graph::Vertex u) -> bool {         // Backtracking DFS.
+            if (path.size() == n) {                                    // All vertices placed: need an arc back.
+                if (!A.test(u, start)) return false;
+                path.push_back(start);                                 // Close the cycle.
+                return true;
+            }
+            const BitMatrix::Word* row = A.row(u);
+            for (std::size_t w = 0; w < W; ++w) {
+                // The recursion restores `used`, so one snapshot per word is exact.
+                for (BitMatrix::Word bits = row[w] & ~used[w]; bits; bits &= bits - 1) {
+                    const Graph::Vertex v = w * 64 + static_cast<std::size_t>(__builtin_ctzll(bits));
+                    usedRow.set(0, v); path.push_back(v);
+                    if (self(self, v)) return true;
+                    path.pop_back(); usedRow.reset(0, v);
+                }
+            }
+            return false;
+        };
+        return dfs(dfs, start);
+    }
+
+    static bool sparse(const Graph& g, std::vector<Graph::Vertex>& path) {
+        const std::size_t n = g.n();
+        std::vector<std::vector<Graph::Vertex>> next(n);               // Sorted distinct successors.
+        for (Graph::Vertex u = 0; u < n; ++u) {
+            for (const auto& e : g.adj(u)) next[u].push_back(e.first);
+            std::sort(next[u].begin(), next[u].end());
+            next[u].erase(std::unique(next[u].begin(), next[u].end()), next[u].end());
+        }
+        std::vector<char> used(n, 0);                                  // Visited flags for path.
+        const Graph::Vertex start = path.front();
+        used[start] = 1;
+
+        auto dfs = [&](auto&& self, Graph::Vertex u) -> bool {         // Backtracking DFS.
+            if (path.size() == n) {                                    // All vertices placed: need an arc back.
+                if (!std::binary_search(next[u].begin(), next[u].end(), start)) return false;
+                path.push_back(start);                                 // Close the cycle.
+                return true;
+            }
+            for (const Graph::Vertex v : next[u]) {
+                if (used[v]) continue;
+                used[v] = 1; path.push_back(v);
+                if (self(self, v)) return true;
+                path.pop_back(); used[v] = 0;
+            }
+            return false;
+        };
+        return dfs(dfs, start);
+    }
+};
+
+// ==================================================================
+// 5) PageRank (pull-based power iteration; see algo/PageRank.hpp)
+//    Spec: PAGERANK[:tol=<x>,iters=<n>,damping=<x>,float,block=<n>,reorder,threads=<n>,engine]
+//    `engine` runs the frontier-engine port (algo/FrontierApps.hpp) instead.
+// ==================================================================
+struct AlgoPageRank final : IGraphAlgorithm {                         // Concrete strategy type.
+    explicit AlgoPageRank(PageRank::Options o, bool e = false) : opt(o), engine(e) {} // Parsed by the factory.
+
+    // Parse option tokens; false on an unknown key or malformed value.
+    static bool parse(const std::vector<std::string>& args, PageRank::Options& o, bool& engine) {
+        for (const auto& a : args) {                                  // Each "key=value" or flag.
+            const auto kv = split_kv(a);
+            bool ok = true;
+            if      (kv.first == "tol")     ok = parse_num(kv.second, o.tolerance);
+            else if (kv.first == "iters")   ok = parse_num(kv.second, o.maxIterations);
+            else if (kv.first == "damping") ok = parse_num(kv.second, o.damping) && o.damping >= 0 && o.damping <= 1;
+            else if (kv.first == "block")   ok = parse_num(kv.second, o.blockSize);
+            else if (kv.first == "threads") ok = parse_num(kv.second, o.threads);
+            else if (kv.first == "float")   o.singlePrecision = true;
+            else if (kv.first == "reorder") o.reorder = true;
+            else if (kv.first == "engine")  engine = true;
+            else ok = false;                                          // Unknown option.
+            if (!ok) return false;
+        }
+        return true;
+    }
+
+    std::string run(const Graph& g) override {                        // Entry point for PageRank.
+        if (g.n() == 0) return "PageRank: empty graph.";              // Nothing to rank.
+        const auto r = engine ? FrontierPageRank(opt).compute(g)      // vertexMap / edgeMap port
+                              : PageRank(opt).compute(g);             // Run the engine.
+
+        double total = 0, worst = 0;                                  // Timing summary.
+        for (double ms : r.iterationMs) { total += ms; worst = std::max(worst, ms); }
+
+        std::vector<std::size_t> ids(g.n());                          // Top-5 by score.
+        std::iota(ids.begin(), ids.end(), 0);
+        const std::size_t k = std::min<std::size_t>(5, ids.size());
+        std::partial_sort(ids.begin(), ids.begin() + k, ids.end(),
+                          [&](std::size_t a, std::size_t b){ return r.rank[a] > r.rank[b]; });
+
+        std::ostringstream oss;                                       // Build message.
+        oss << "PageRank: " << (r.converged ? "converged" : "not converged")
+            << " after " << r.iterations << " iterations (residual "
+            << std::setprecision(3) << r.residual
+            << ", " << (r.iterations ? total / r.iterations : 0.0) << " ms/iter avg, "
+            << worst << " ms max, ";
+        if (engine) oss << "frontier engine); top:";
+        else oss << (opt.singlePrecision ? "float" : "double")
+                 << ", " << r.blocks << (r.blocks == 1 ? " block" : " blocks") << "); top:";
+        oss << std::fixed << std::setprecision(4);
+        for (std::size_t i = 0; i < k; ++i) oss << " " << ids[i] << "=" << r.rank[ids[i]];
+        return oss.str();                                             // Return.
+    }
+
+    PageRank::Options opt;                                            // Engine configuration.
+    bool engine;                                                      // frontier-engine port
+};
+
+// ==================================================================
+// 6) Maximum bipartite matching (Hopcroft–Karp; see algo/Matching.hpp)
+//    Spec: MATCHING[:ks|greedy|none,threads=<n>]
+// ==================================================================
+struct AlgoMatching final : IGraphAlgorithm {                         // Concrete strategy type.
+    explicit AlgoMatching(BipartiteMatching::Options o) : opt(o) {}   // Options parsed by the factory.
+
+    // Parse option tokens; false on an unknown key or malformed value.
+    static bool parse(const std::vector<std::string>& args, BipartiteMatching::Options& o) {
+        for (const auto& a : args) {
+            const auto kv = split_kv(a);
+            bool ok = true;
+            if      (kv.first == "ks")      o.init = BipartiteMatching::Init::KarpSipser;
+            else if (kv.first == "greedy")  o.init = BipartiteMatching::Init::Greedy;
+            else if (kv.first == "none")    o.init = BipartiteMatching::Init::None;
+            else if (kv.first == "threads") ok = parse_num(kv.second, o.threads);
+            else ok = false;                                          // Unknown option.
+            if (!ok) return false;
+        }
+        return true;
+    }
+
+    std::string run(const Graph& g) override {                        // Entry point for matching.
+        const auto r = BipartiteMatching(opt).compute(g);             // Color + match.
+        std::ostringstream oss;                                       // Build message.
+        if (!r.bipartite) {                                           // Odd cycle → no bipartition.
+            oss << "Graph is not bipartite (odd cycle through edge "
+                << r.conflict.first << "-" << r.conflict.second << "); no matching computed.";
+            return oss.str();
+        }
+        oss << "Maximum matching: " << r.size << " pairs ("
+            << r.initialSize << " seeded, " << r.phases << " Hopcroft-Karp phases):";
+        for (const auto& p : r.pairs) oss << " " << p.first << "-" << p.second; // side-0 vertex first
+        return oss.str();                                             // Return.
+    }
+
+    BipartiteMatching::Options opt;                                   // Engine configuration.
+};
+
+// ==================================================================
+// 7) Bridges / articulation points / biconnected blocks
+//    Spec: BICONNECTED   (see algo/Biconnected.hpp)
+// ==================================================================
+struct AlgoBiconnected final : IGraphAlgorithm {                      // Concrete strategy type.
+    std::string run(const Graph& g) override {                        // Entry point.
+        const auto r = Biconnectivity().compute(g);                   // One low-link pass.
+        std::ostringstream oss;                                       // Build message.
+        oss << "Bridges: " << r.bridges.size() << " [";
+        for (std::size_t i = 0; i < r.bridges.size(); ++i)
+            oss << (i ? " " : "") << r.bridges[i].first << "-" << r.bridges[i].second;
+        oss << "]; articulation points: " << r.articulationPoints.size() << " [";
+        for (std::size_t i = 0; i < r.articulationPoints.size(); ++i)
+            oss << (i ? " " : "") << r.articulationPoints[i];
+        oss << "]; biconnected blocks: " << r.blocks
+            << "; connected components: " << r.components << ".";
+        return oss.str();                                             // Return.
+    }
+};
+
+// ==================================================================
+// 8) Batched reachability queries (see algo/Reachability.hpp)
+//    Spec: REACH:<u>-<v>,<u>-<v>,...[,closure|interval,labels=<n>,threads=<n>]
+//    Answers are printed as a 0/1 string in query order.
+// ==================================================================
+struct AlgoReach final : IGraphAlgorithm {                            // Concrete strategy type.
+    AlgoReach(ReachabilityIndex::Options o,
+              std::vector<std::pair<Graph::Vertex, Graph::Vertex>> q)
+        : opt(o), queries(std::move(q)) {}                            // Parsed by the factory.
+
+    // Parse "u-v" pairs and option tokens; false on anything malformed.
+    static bool parse(const std::vector<std::string>& args, ReachabilityIndex::Options& o,
+                      std::vector<std::pair<Graph::Vertex, Graph::Vertex>>& q) {
+        for (const auto& a : args) {
+            const auto dash = a.find('-');
+            if (dash != std::string::npos && a.find('=') == std::string::npos) { // query pair
+                Graph::Vertex u = 0, v = 0;
+                if (!parse_num(a.substr(0, dash), u) || !parse_num(a.substr(dash + 1), v)) return false;
+                q.emplace_back(u, v);
+                continue;
+            }
+            const auto kv = split_kv(a);
+            bool ok = true;
+            if      (kv.first == "closure")  o.mode = ReachabilityIndex::Mode::Closure;
+            else if (kv.first == "interval") o.mode = ReachabilityIndex::Mode::Interval;
+            else if (kv.first == "labels")   ok = parse_num(kv.second, o.labels) && o.labels > 0;
+            else if (kv.first == "threads")  ok = parse_num(kv.second, o.threads);
+            else ok = false;                                          // Unknown option.
+            if (!ok) return false;
+        }
+        return !q.empty();                                            // Nothing to answer → malformed.
+    }
+
+    std::string run(const Graph& g) override {                        // Entry point.
+        for (const auto& uv : queries)                                // Validate against this graph.
+            if (uv.first >= g.n() || uv.second >= g.n()) {
+                std::ostringstream err;
+                err << "Reachability: query " << uv.first << "-" << uv.second
+                    << " is out of range (graph has " << g.n() << " vertices).";
+                return err.str();
+            }
+        const ReachabilityIndex idx(g, opt);                          // Condense + index once.
+        const auto ans = idx.query(queries);                          // Batch of O(1)-ish lookups.
+
+        std::size_t yes = 0;
+        std::string bits(ans.size(), '0');
+        for (std::size_t i = 0; i < ans.size(); ++i) if (ans[i]) { bits[i] = '1'; ++yes; }
+
+        std::ostringstream oss;                                       // Build message.
+        oss << "Reachability (" << (idx.mode() == ReachabilityIndex::Mode::Closure ? "closure" : "interval")
+            << " index, " << idx.components() << " components, " << queries.size() << " queries, "
+            << yes << " reachable): " << bits;
+        return oss.str();                                             // Return.
+    }
+
+    ReachabilityIndex::Options opt;                                   // Engine configuration.
+    std::vector<std::pair<Graph::Vertex, Graph::Vertex>> queries;     // (source, target) pairs.
+};
+
+// ==================================================================
+// 9) Minimum-cost flow (see algo/MinCostFlow.hpp)
+//    Spec: MINCOSTFLOW [s t [k]]   (default 0 -> n-1, as much as fits)
+//    Capacities are edge weights, costs the Graph's cost attribute.
+// ==================================================================
+struct AlgoMinCostFlow final : IGraphAlgorithm {                      // Concrete strategy type.
+    using Weight = MinCostFlow::Weight;
+    AlgoMinCostFlow(bool st, Graph::Vertex src, Graph::Vertex dst, Weight k)
+        : explicitEnds(st), s(src), t(dst), limit(k) {}               // Parsed by the factory.
+
+    std::string run(const Graph& g) override {                        // Entry point.
+        const std::size_t n = g.n();
+        if (n < 2) return "Min-cost flow: 0 (need at least two vertices).";
+        const Graph::Vertex src = explicitEnds ? s : 0;
+        const Graph::Vertex dst = explicitEnds ? t : n - 1;
+        if (src >= n || dst >= n) {
+            std::ostringstream err;
+            err << "Min-cost flow: terminal out of range (graph has " << n << " vertices).";
+            return err.str();
+        }
+        MinCostFlow::Result r;
+        try {
+            r = MinCostFlow().compute(g, src, dst, limit);            // SSP + potentials.
+        } catch (const std::invalid_argument&) {                      // negative capacity
+            return "Min-cost flow: capacities must be non-negative.";
+        }
+        if (r.negativeCycle) return "Min-cost flow: costs contain a negative cycle.";
+
+        std::ostringstream oss;                                       // Build message.
+        oss << "Min-cost flow (" << src << " -> " << dst << "): flow " << r.flow
+            << ", cost " << r.cost << " (" << r.augmentations << " augmenting paths)";
+        if (!r.arcs.empty()) {
+            oss << "; arcs:";
+            for (const auto& a : r.arcs)
+                oss << " " << std::get<0>(a) << "-" << std::get<1>(a) << "=" << std::get<2>(a);
+        }
+        oss << ".";
+        return oss.str();                                             // Return.
+    }
+
+    bool explicitEnds;                                                // s/t given in the spec
+    Graph::Vertex s, t;                                               // terminals
+    Weight limit;                                                     // flow cap k
+};
+
+// ==================================================================
+// 10) Distance metrics from one multi-source BFS (see algo/MultiSourceBfs.hpp)
+//     Specs: DIAMETER | ECCENTRICITY | CLOSENESS  [:width=<64..512>,threads=<n>]
+//     Distances are hop counts along arc direction.
+// ==================================================================
+struct AlgoDistances final : IGraphAlgorithm {                        // Concrete strategy type.
+    enum class Metric { Diameter, Eccentricity, Closeness };
+    AlgoDistances(Metric m, MultiSourceBfs::Options o) : metric(m), opt(o) {} // Parsed by the factory.
+
+    // Parse option tokens; false on an unknown key or malformed value.
+    static bool parse(const std::vector<std::string>& args, MultiSourceBfs::Options& o) {
+        for (const auto& a : args) {
+            const auto kv = split_kv(a);
+            bool ok = true;
+            if      (kv.first == "width")   ok = parse_num(kv.second, o.width) && o.width >= 64 && o.width <= 512;
+            else if (kv.first == "threads") ok = parse_num(kv.second, o.threads);
+            else ok = false;                                          // Unknown option.
+            if (!ok) return false;
+        }
+        return true;
+    }
+
+    std::string run(const Graph& g) override {                        // Entry point.
+        const std::size_t n = g.n();
+        if (n == 0) return "Distances: empty graph.";
+        const auto r = MultiSourceBfs(opt).compute(g);                // All sources, batched.
+        std::ostringstream oss;                                       // Build message.
+
+        if (metric == Metric::Closeness) {                            // Wasserman–Faust closeness.
+            std::vector<double> c(n, 0.0);
+            for (std::size_t v = 0; v < n; ++v)
+                if (r.distanceSum[v] > 0 && n > 1) {
+                    const double k = static_cast<double>(r.reached[v] - 1);
+                    c[v] = (k / static_cast<double>(n - 1)) * (k / static_cast<double>(r.distanceSum[v]));
+                }
+            std::vector<std::size_t> ids(n);                          // Top-5 by score.
+            std::iota(ids.begin(), ids.end(), 0);
+            const std::size_t k = std::min<std::size_t>(5, n);
+            std::partial_sort(ids.begin(), ids.begin() + k, ids.end(),
+                              [&](std::size_t a, std::size_t b){ return c[a] > c[b]; });
+            oss << "Closeness (" << r.batches << " MS-BFS batches x " << r.width << " sources); top:";
+            oss << std::fixed << std::setprecision(4);
+            for (std::size_t i = 0; i < k; ++i) oss << " " << ids[i] << "=" << c[ids[i]];
+            return oss.str();                                         // Return.
+        }
+
+        // A vertex that misses someone has infinite eccentricity.
+        const char* how = g.directed() ? "strongly connected" : "connected";
+        if (metric == Metric::Eccentricity) {
+            oss << "Eccentricity:";
+            for (std::size_t v = 0; v < n; ++v) {
+                oss << " " << v << "=";
+                if (r.reached[v] == n) oss << r.eccentricity[v]; else oss << "inf";
+            }
+            return oss.str();                                         // Return.
+        }
+
+        std::size_t diam = 0, rad = n, finite = 0;
+        bool all = true;
+        for (std::size_t v = 0; v < n; ++v) {
+            finite = std::max(finite, r.eccentricity[v]);
+            if (r.reached[v] != n) { all = false; continue; }
+            diam = std::max(diam, r.eccentricity[v]);
+            rad  = std::min(rad, r.eccentricity[v]);
+        }
+        if (!all) {
+            oss << "Diameter: infinite (graph is not " << how << "); largest finite distance " << finite << ".";
+            return oss.str();                                         // Return.
+        }
+        std::vector<std::size_t> center;
+        for (std::size_t v = 0; v < n; ++v) if (r.eccentricity[v] == rad) center.push_back(v);
+        oss << "Diameter: " << diam << ", radius: " << rad << "; center:";
+        for (std::size_t i = 0; i < center.size() && i < 10; ++i) oss << " " << center[i];
+        if (center.size() > 10) oss << " ... (" << center.size() << " vertices)";
+        oss << ".";
+        return oss.str();                                             // Return.
+    }
+
+    Metric metric;                                                    // What to report.
+    MultiSourceBfs::Options opt;                                      // Engine configuration.
+};
+
+// ==================================================================
+// 11) Betweenness centrality (Brandes; see algo/Betweenness.hpp)
+//     Spec: BETWEENNESS[:samples=<k>|eps=<e>,delta=<p>,seed=<s>,threads=<n>]
+// ==================================================================
+struct AlgoBetweenness final : IGraphAlgorithm {                      // Concrete strategy type.
+    explicit AlgoBetweenness(Betweenness::Options o) : opt(o) {}      // Options parsed by the factory.
+
+    // Parse option tokens; false on an unknown key or malformed value.
+    static bool parse(const std::vector<std::string>& args, Betweenness::Options& o) {
+        for (const auto& a : args) {
+            const auto kv = split_kv(a);
+            bool ok = true;
+            if      (kv.first == "samples") ok = parse_num(kv.second, o.samples) && o.samples > 0;
+            else if (kv.first == "eps")     ok = parse_num(kv.second, o.epsilon) && o.epsilon > 0;
+            else if (kv.first == "delta")   ok = parse_num(kv.second, o.delta) && o.delta > 0 && o.delta < 1;
+            else if (kv.first == "seed")    ok = parse_num(kv.second, o.seed);
+            else if (kv.first == "threads") ok = parse_num(kv.second, o.threads);
+            else ok = false;                                          // Unknown option.
+            if (!ok) return false;
+        }
+        return true;
+    }
+
+    std::string run(const Graph& g) override {                        // Entry point.
+        if (g.n() == 0) return "Betweenness: empty graph.";
+        const auto r = Betweenness(opt).compute(g);                   // Brandes over the sources.
+
+        std::vector<std::size_t> ids(g.n());                          // Top-5 by score.
+        std::iota(ids.begin(), ids.end(), 0);
+        const std::size_t k = std::min<std::size_t>(5, ids.size());
+        std::partial_sort(ids.begin(), ids.begin() + k, ids.end(),
+                          [&](std::size_t a, std::size_t b){ return r.score[a] > r.score[b]; });
+
+        std::ostringstream oss;                                       // Build message.
+        oss << "Betweenness (";
+        if (r.exact) oss << "exact, " << r.sources << " sources";
+        else oss << "approximate, " << r.sources << " sampled sources, error <= "
+                 << std::setprecision(4) << r.errorBound << " with probability "
+                 << std::setprecision(3) << 1.0 - opt.delta;
+        oss << "); top:" << std::fixed << std::setprecision(2);
+        for (std::size_t i = 0; i < k; ++i) oss << " " << ids[i] << "=" << r.score[ids[i]];
+        return oss.str();                                             // Return.
+    }
+
+    Betweenness::Options opt;                                         // Engine configuration.
+};
+
+// ==================================================================
+// 12) Greedy vertex coloring (see algo/Coloring.hpp)
+//     Spec: COLORING[:dsatur|lf|jp,seed=<s>,threads=<n>]
+// ==================================================================
+struct AlgoColoring final : IGraphAlgorithm {                         // Concrete strategy type.
+    explicit AlgoColoring(GraphColoring::Options o) : opt(o) {}       // Options parsed by the factory.
+
+    // Parse option tokens; false on an unknown key or malformed value.
+    static bool parse(const std::vector<std::string>& args, GraphColoring::Options& o) {
+        for (const auto& a : args) {
+            const auto kv = split_kv(a);
+            bool ok = true;
+            if      (kv.first == "dsatur")  o.method = GraphColoring::Method::DSatur;
+            else if (kv.first == "lf")      o.method = GraphColoring::Method::LargestFirst;
+            else if (kv.first == "jp")      o.method = GraphColoring::Method::JonesPlassmann;
+            else if (kv.first == "seed")    ok = parse_num(kv.second, o.seed);
+            else if (kv.first == "threads") ok = parse_num(kv.second, o.threads);
+            else ok = false;                                          // Unknown option.
+            if (!ok) return false;
+        }
+        return true;
+    }
+
+    std::string run(const Graph& g) override {                        // Entry point.
+        const auto r = GraphColoring(opt).compute(g);                 // Color all vertices.
+        std::ostringstream oss;                                       // Build message.
+        oss << "Coloring (";
+        switch (opt.method) {
+        case GraphColoring::Method::DSatur:         oss << "DSatur"; break;
+        case GraphColoring::Method::LargestFirst:   oss << "largest-first"; break;
+        case GraphColoring::Method::JonesPlassmann: oss << "Jones-Plassmann, " << r.rounds << " rounds"; break;
+        }
+        oss << "): " << r.colors << (r.colors == 1 ? " color;" : " colors;");
+        for (std::size_t v = 0; v < r.color.size(); ++v) oss << " " << v << "=" << r.color[v];
+        return oss.str();                                             // Return.
+    }
+
+    GraphColoring::Options opt;                                       // Engine configuration.
+};
+
+// ==================================================================
+// 13) Maximum clique (bitset branch and bound; see algo/MaxClique.hpp)
+//     Spec: MAXCLIQUE[:timeout=<ms>,threads=<n>]   (timeout 0 = none)
+//     The deadline starts when run() starts, so a worst-case input only
+//     holds its workers for `timeout` ms and still returns a clique.
+// ==================================================================
+struct AlgoMaxClique final : IGraphAlgorithm {                        // Concrete strategy type.
+    AlgoMaxClique(unsigned t, long long ms) : threads(t), timeoutMs(ms) {} // Parsed by the factory.
+
+    // Parse option tokens; false on an unknown key or malformed value.
+    static bool parse(const std::vector<std::string>& args, unsigned& threads, long long& ms) {
+        for (const auto& a : args) {
+            const auto kv = split_kv(a);
+            bool ok = true;
+            if      (kv.first == "timeout") ok = parse_num(kv.second, ms) && ms >= 0;
+            else if (kv.first == "threads") ok = parse_num(kv.second, threads);
+            else ok = false;                                          // Unknown option.
+            if (!ok) return false;
+        }
+        return true;
+    }
+
+    std::string run(const Graph& g) override {                        // Entry point.
+        MaxClique::Options o;
+        o.threads = threads;
+        if (g.n() > o.maxVertices) {
+            std::ostringstream err;
+            err << "Maximum clique: graph has " << g.n() << " vertices; the bitset search supports up to "
+                << o.maxVertices << ".";
+            return err.str();
+        }
+        if (timeoutMs > 0) o.cancel = CancelToken::after(std::chrono::milliseconds(timeoutMs));
+        const auto r = MaxClique(o).compute(g);                       // Branch and bound.
+
+        std::ostringstream oss;                                       // Build message.
+        oss << (r.optimal ? "Maximum clique: size " : "Clique search hit the deadline; best found: size ")
+            << r.clique.size() << " [";
+        for (std::size_t i = 0; i < r.clique.size(); ++i) oss << (i ? " " : "") << r.clique[i];
+        oss << "] (" << r.nodes << " search nodes, coloring bound " << r.colorBound << ").";
+        return oss.str();                                             // Return.
+    }
+
+    unsigned  threads;                                                // participants
+    long long timeoutMs;                                              // deadline per run
+};
+
+// ==================================================================
+// 14) BFS levels and 15) connected components on the frontier engine
+//     (vertexMap / edgeMap, push or pull per round; see algo/Frontier.hpp)
+//     Spec: BFS[:source=<v>,divisor=<k>,threads=<n>]
+//           COMPONENTS[:divisor=<k>,threads=<n>]
+// ==================================================================
+// Shared engine options: divisor= sets EdgeMapOptions::denseDivisor.
+static bool parse_edge_map(const std::pair<std::string, std::string>& kv, EdgeMapOptions& o, bool& ok) {
+    if      (kv.first == "divisor") ok = parse_num(kv.second, o.denseDivisor) && o.denseDivisor > 0;
+    else if (kv.first == "threads") ok = parse_num(kv.second, o.threads);
+    else return false;                                                // Not an engine option.
+    return true;
+}
+
+struct AlgoBfs final : IGraphAlgorithm {                              // Concrete strategy type.
+    AlgoBfs(EdgeMapOptions o, Graph::Vertex s) : opt(o), source(s) {} // Parsed by the factory.
+
+    // Parse option tokens; false on an unknown key or malformed value.
+    static bool parse(const std::vector<std::string>& args, EdgeMapOptions& o, Graph::Vertex& s) {
+        for (const auto& a : args) {
+            const auto kv = split_kv(a);
+            bool ok = true;
+            if (kv.first == "source") ok = parse_num(kv.second, s);
+            else if (!parse_edge_map(kv, o, ok)) ok = false;          // Unknown option.
+            if (!ok) return false;
+        }
+        return true;
+    }
+
+    std::string run(const Graph& g) override {                       // Entry point.
+        if (source >= g.n()) {
+            std::ostringstream err;
+            err << "BFS: source " << source << " out of range (n=" << g.n() << ").";
+            return err.str();
+        }
+        const auto r = FrontierBfs(opt).compute(g, source);          // One edgeMap per level.
+        const long long depth = r.rounds ? static_cast<long long>(r.rounds) - 1 : 0;
+
+        std::ostringstream oss;                                       // Build message.
+        oss << "BFS from " << source << ": reached " << r.reached << " of " << g.n()
+            << " vertices, depth " << depth << " (" << r.rounds << " rounds, "
+            << r.denseRounds << " pull); levels:";
+        for (std::size_t v = 0; v < r.level.size(); ++v) {
+            oss << " " << v << "=";
+            if (r.level[v] < 0) oss << "inf"; else oss << r.level[v];
+        }
+        return oss.str();                                             // Return.
+    }
+
+    EdgeMapOptions opt;                                               // Engine configuration.
+    Graph::Vertex  source;                                            // BFS root
+};
+
+struct AlgoComponents final : IGraphAlgorithm {                       // Concrete strategy type.
+    explicit AlgoComponents(EdgeMapOptions o) : opt(o) {}             // Options parsed by the factory.
+
+    // Parse option tokens; false on an unknown key or malformed value.
+    static bool parse(const std::vector<std::string>& args, EdgeMapOptions& o) {
+        for (const auto& a : args) {
+            bool ok = true;
+            if (!parse_edge_map(split_kv(a), o, ok)) ok = false;      // Unknown option.
+            if (!ok) return false;
+        }
+        return true;
+    }
+
+    std::string run(const Graph& g) override {                       // Entry point.
+        const auto r = FrontierComponents(opt).compute(g);            // Label propagation.
+        std::ostringstream oss;                                       // Build message.
+        oss << "Components: " << r.components << " (" << r.rounds << " rounds"
+            << (g.directed() ? ", weak" : "") << ");";
+        for (std::size_t v = 0; v < r.label.size(); ++v) oss << " " << v << "=" << r.label[v];
+        return oss.str();                                             // Return.
+    }
+
+    EdgeMapOptions opt;                                               // Engine configuration.
+};
+
+// ==================================================================
+// 16) Single-source shortest paths (min-plus x·A; see algo/ShortestPaths.hpp)
+//     Spec: SSSP[:source=<v>,divisor=<k>,threads=<n>]
+// ==================================================================
+struct AlgoSssp final : IGraphAlgorithm {                             // Concrete strategy type.
+    AlgoSssp(EdgeMapOptions o, Graph::Vertex s) : opt(o), source(s) {} // Parsed by the factory.
+
+    std::string run(const Graph& g) override {                       // Entry point.
+        if (source >= g.n()) {
+            std::ostringstream err;
+            err << "SSSP: source " << source << " out of range (n=" << g.n() << ").";
+            return err.str();
+        }
+        const auto r = ShortestPaths(opt).compute(g, source);        // Bellman–Ford rounds.
+        std::ostringstream oss;                                       // Build message.
+        if (r.negativeCycle) {
+            oss << "SSSP from " << source << ": negative cycle reachable from the source.";
+            return oss.str();
+        }
+        oss << "SSSP from " << source << ": reached " << r.reached << " of " << g.n()
+            << " vertices (" << r.rounds << " rounds, " << r.denseRounds << " dense); dist:";
+        for (std::size_t v = 0; v < r.dist.size(); ++v) {
+            oss << " " << v << "=";
+            if (r.dist[v] == ShortestPaths::kUnreached) oss << "inf"; else oss << r.dist[v];
+        }
+        return oss.str();                                             // Return.
+    }
+
+    EdgeMapOptions opt;                                               // Direction rule, threads.
+    Graph::Vertex  source;                                            // SSSP root
 };
 
+// =====================================================
+// Option parsers: spec tokens (after the name) → configured strategy
+// =====================================================
+using Args = std::vector<std::string>;                             // Option tokens after the name.
+using Strategy = std::unique_ptr<IGraphAlgorithm>;                 // What the factory hands out.
+
+static constexpr long long kDefaultCliqueMs = 10000;               // MAXCLIQUE default budget: 10 s.
+
+template <typename T>
+static Strategy make_plain(const Args& args) {                      // No options understood:
+    if (!args.empty()) return nullptr;                              // "MST junk" is an error, not MST.
+    return std::make_unique<T>();
+}
+
+static Strategy make_scc(const Args& args) {
+    bool dag = false;
+    for (const auto& a : args) {                                    // Only "dag" is understood.
+        if (to_lower(a) == "dag") dag = true;
+        else return nullptr;
+    }
+    return std::make_unique<AlgoSccCount>(dag);
+}
+
+static Strategy make_pagerank(const Args& args) {
+    PageRank::Options o;
+    bool engine = false;
+    if (!AlgoPageRank::parse(args, o, engine)) return nullptr;      // Malformed options → caller handles.
+    return std::make_unique<AlgoPageRank>(o, engine);
+}
+
+static Strategy make_matching(const Args& args) {
+    BipartiteMatching::Options o;
+    if (!AlgoMatching::parse(args, o)) return nullptr;
+    return std::make_unique<AlgoMatching>(o);
+}
+
+static Strategy make_reach(const Args& args) {
+    ReachabilityIndex::Options o;
+    std::vector<std::pair<Graph::Vertex, Graph::Vertex>> q;
+    if (!AlgoReach::parse(args, o, q)) return nullptr;
+    return std::make_unique<AlgoReach>(o, std::move(q));
+}
+
+static Strategy make_mincostflow(const Args& args) {               // [s t [k]]
+    Graph::Vertex s = 0, t = 0;
+    MinCostFlow::Weight k = std::numeric_limits<MinCostFlow::Weight>::max();
+    if (args.size() == 1 || args.size() > 3) return nullptr;        // s without t / too many.
+    if (args.size() >= 2 && (!parse_num(args[0], s) || !parse_num(args[1], t))) return nullptr;
+    if (args.size() == 3 && (!parse_num(args[2], k) || k < 0)) return nullptr;
+    return std::make_unique<AlgoMinCostFlow>(!args.empty(), s, t, k);
+}
+
+template <AlgoDistances::Metric M>
+static Strategy make_distances(const Args& args) {
+    MultiSourceBfs::Options o;
+    if (!AlgoDistances::parse(args, o)) return nullptr;
+    return std::make_unique<AlgoDistances>(M, o);
+}
+
+static Strategy make_betweenness(const Args& args) {
+    Betweenness::Options o;
+    if (!AlgoBetweenness::parse(args, o)) return nullptr;
+    return std::make_unique<AlgoBetweenness>(o);
+}
+
+static Strategy make_coloring(const Args& args) {
+    GraphColoring::Options o;
+    if (!AlgoColoring::parse(args, o)) return nullptr;
+    return std::make_unique<AlgoColoring>(o);
+}
+
+static Strategy make_maxclique(const Args& args) {
+    unsigned threads = 0;
+    long long ms = kDefaultCliqueMs;
+    if (!AlgoMaxClique::parse(args, threads, ms)) return nullptr;
+    return std::make_unique<AlgoMaxClique>(threads, ms);
+}
+
+static Strategy make_bfs(const Args& args) {
+    EdgeMapOptions o;
+    Graph::Vertex s = 0;
+    if (!AlgoBfs::parse(args, o, s)) return nullptr;
+    return std::make_unique<AlgoBfs>(o, s);
+}
+
+static Strategy make_sssp(const Args& args) {                      // Same options as BFS.
+    EdgeMapOptions o;
+    Graph::Vertex s = 0;
+    if (!AlgoBfs::parse(args, o, s)) return nullptr;
+    return std::make_unique<AlgoSssp>(o, s);
+}
+
+static Strategy make_components(const Args& args) {
+    EdgeMapOptions o;
+    if (!AlgoComponents::parse(args, o)) return nullptr;
+    return std::make_unique<AlgoComponents>(o);
+}
+
+// =====================================================
+// Registry: one entry per GRAPH_ALGORITHM_LIST id
+// =====================================================
+template <AlgorithmId Id> struct Registered;                      // Specialised by the macro below only.
+
+// REGISTER_GRAPH_ALGORITHM(Id, make, default-strategy-expression)
+//   File-local helper: the id must already be in GRAPH_ALGORITHM_LIST, and
+//   the strategy types it names are the ones defined above.
+//   make(args)  builds the strategy from option tokens (nullptr if malformed);
+//   the expression is the strategy "NAME" means without options. run() keeps
+//   it on the stack and calls the final type directly (no vtable, no heap).
+#define REGISTER_GRAPH_ALGORITHM(ID, MAKE, ...)                                      \
+    template <> struct Registered<AlgorithmId::ID> {                                  \
+        static Strategy make(const Args& args) { return MAKE(args); }                 \
+        static std::string run(const Graph& g) { auto alg = __VA_ARGS__; return alg.run(g); } \
+    }
+
+REGISTER_GRAPH_ALGORITHM(Mst,          make_plain<AlgoMstWeight>,   AlgoMstWeight{});
+REGISTER_GRAPH_ALGORITHM(Scc,          make_scc,                    AlgoSccCount{});
+REGISTER_GRAPH_ALGORITHM(MaxFlow,      make_plain<AlgoMaxFlow>,     AlgoMaxFlow{});
+REGISTER_GRAPH_ALGORITHM(Hamilton,     make_plain<AlgoHamilton>,    AlgoHamilton{});
+REGISTER_GRAPH_ALGORITHM(PageRank,     make_pagerank,               AlgoPageRank(PageRank::Options{}));
+REGISTER_GRAPH_ALGORITHM(Matching,     make_matching,               AlgoMatching(BipartiteMatching::Options{}));
+REGISTER_GRAPH_ALGORITHM(Biconnected,  make_plain<AlgoBiconnected>, AlgoBiconnected{});
+REGISTER_GRAPH_ALGORITHM(Reach,        make_reach,                  AlgoReach(ReachabilityIndex::Options{}, {}));
+REGISTER_GRAPH_ALGORITHM(MinCostFlow,  make_mincostflow,
+                         AlgoMinCostFlow(false, 0, 0, std::numeric_limits<MinCostFlow::Weight>::max()));
+REGISTER_GRAPH_ALGORITHM(Diameter,     make_distances<AlgoDistances::Metric::Diameter>,
+                         AlgoDistances(AlgoDistances::Metric::Diameter, MultiSourceBfs::Options{}));
+REGISTER_GRAPH_ALGORITHM(Eccentricity, make_distances<AlgoDistances::Metric::Eccentricity>,
+                         AlgoDistances(AlgoDistances::Metric::Eccentricity, MultiSourceBfs::Options{}));
+REGISTER_GRAPH_ALGORITHM(Closeness,    make_distances<AlgoDistances::Metric::Closeness>,
+                         AlgoDistances(AlgoDistances::Metric::Closeness, MultiSourceBfs::Options{}));
+REGISTER_GRAPH_ALGORITHM(Betweenness,  make_betweenness,            AlgoBetweenness(Betweenness::Options{}));
+REGISTER_GRAPH_ALGORITHM(Coloring,     make_coloring,               AlgoColoring(GraphColoring::Options{}));
+REGISTER_GRAPH_ALGORITHM(MaxClique,    make_maxclique,              AlgoMaxClique(0, kDefaultCliqueMs));
+REGISTER_GRAPH_ALGORITHM(Bfs,          make_bfs,                    AlgoBfs(EdgeMapOptions{}, 0));
+REGISTER_GRAPH_ALGORITHM(Components,   make_components,             AlgoComponents(EdgeMapOptions{}));
+REGISTER_GRAPH_ALGORITHM(Sssp,         make_sssp,                   AlgoSssp(EdgeMapOptions{}, 0));
+
+// Static dispatch tables indexed by AlgorithmId (an unregistered id fails to compile).
+using Maker  = Strategy (*)(const Args&);
+using Runner = std::string (*)(const Graph&);
+#define GRAPH_ALGORITHM_MAKER(id, name)  &Registered<AlgorithmId::id>::make,
+#define GRAPH_ALGORITHM_RUNNER(id, name) &Registered<AlgorithmId::id>::run,
+static constexpr std::array<Maker, kAlgorithmCount>  kMakers  = {{ GRAPH_ALGORITHM_LIST(GRAPH_ALGORITHM_MAKER) }};
+static constexpr std::array<Runner, kAlgorithmCount> kRunners = {{ GRAPH_ALGORITHM_LIST(GRAPH_ALGORITHM_RUNNER) }};
+#undef GRAPH_ALGORITHM_MAKER
+#undef GRAPH_ALGORITHM_RUNNER
+
 // =====================================================
 // Factory definition (matches header declaration)
 // =====================================================
+bool AlgorithmFactory::parseId(std::string_view name, AlgorithmId& id) noexcept {
+    for (std::size_t i = 0; i < kAlgorithmCount; ++i) {            // Few names: a linear scan is fine.
+        const std::string_view cand = kAlgorithmNames[i];
+        if (cand.size() != name.size()) continue;                   // Cheap length filter first.
+        std::size_t k = 0;                                          // Case-insensitive compare in place.
+        while (k < cand.size() &&
+               std::toupper(static_cast<unsigned char>(name[k])) == static_cast<unsigned char>(cand[k])) ++k;
+        if (k == cand.size()) { id = static_cast<AlgorithmId>(i); return true; }
+    }
+    return false;                                                   // Unknown name.
+}
+
+std::unique_ptr<IGraphAlgorithm>
+AlgorithmFactory::create(AlgorithmId id, const std::vector<std::string>& args) {
+    return kMakers[static_cast<std::size_t>(id)](args);             // Registered option parser.
+}
+
 std::unique_ptr<IGraphAlgorithm>                                   // Return unique_ptr to created strategy.
 AlgorithmFactory::create(const std::string& name) {                // Define factory method declared in header.
-    const auto n = to_lower(name);                                  // Normalize the name to lowercase.
-    if (n == "mst")      return std::make_unique<AlgoMstWeight>();  // Create MST strategy.
-    if (n == "scc")      return std::make_unique<AlgoSccCount>();   // Create SCC strategy.
-    if (n == "maxflow")  return std::make_unique<AlgoMaxFlow>();    // Create Max Flow strategy.
-    if (n == "hamilton") return std::make_unique<AlgoHamilton>();   // Create Hamiltonian strategy.
-    return nullptr;                                                 // Unknown name → caller handles error.
+    auto args = split_spec(name);                                   // Split "NAME[:args]" into tokens.
+    AlgorithmId id;
+    if (args.empty() || !parseId(args.front(), id)) return nullptr; // Blank or unknown name → caller handles error.
+    args.erase(args.begin());                                       // Keep only the arguments.
+    return create(id, args);
+}
+
+std::string AlgorithmFactory::run(AlgorithmId id, const Graph& g) {
+    return kRunners[static_cast<std::size_t>(id)](g);               // Default-configured strategy.
 }
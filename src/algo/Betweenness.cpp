@@ -0,0 +1,103 @@
+// ==========================
+// Betweenness.cpp
+// ==========================
+// Parallel (optionally sampled) Brandes declared in algo/Betweenness.hpp.
+// The backward sweep walks successors (dist + 1) instead of predecessor
+// lists, so one out-adjacency CSR serves both phases.
+// ==========================
+
+#include "algo/Betweenness.hpp"  // class declaration
+#include "algo/Parallel.hpp"     // parallel_for, parallel_slots
+#include "graph/Csr.hpp"         // flat out-adjacency
+#include <algorithm>             // std::fill, std::min
+#include <cmath>                 // std::ceil, std::log, std::sqrt
+#include <numeric>               // std::iota
+#include <random>                // std::mt19937 for sampling
+
+namespace {
+using Index = Csr::Index;                                     // compact vertex id
+
+// Per-participant state: BFS arrays reused across sources plus the
+// participant's private score accumulator.
+struct Worker {
+    std::vector<double> sigma, dep, acc;                      // path counts, dependencies, scores
+    std::vector<long long> dist;                              // hop distance (-1 = unseen)
+    std::vector<Index> order;                                 // vertices in BFS order
+};
+
+void single_source(const Csr& adj, Index s, Worker& w) {
+    w.order.clear();
+    w.order.push_back(s);
+    w.dist[s] = 0; w.sigma[s] = 1;
+    for (std::size_t i = 0; i < w.order.size(); ++i) {        // forward: BFS counting shortest paths
+        const Index v = w.order[i];
+        for (std::size_t p = adj.offsets[v]; p < adj.offsets[v + 1]; ++p) {
+            const Index u = adj.targets[p];
+            if (w.dist[u] < 0) { w.dist[u] = w.dist[v] + 1; w.order.push_back(u); }
+            if (w.dist[u] == w.dist[v] + 1) w.sigma[u] += w.sigma[v];
+        }
+    }
+    for (std::size_t i = w.order.size(); i-- > 0; ) {         // backward: accumulate dependencies
+        const Index v = w.order[i];
+        double d = 0;
+        for (std::size_t p = adj.offsets[v]; p < adj.offsets[v + 1]; ++p) {
+            const Index u = adj.targets[p];
+            if (w.dist[u] == w.dist[v] + 1) d += w.sigma[v] / w.sigma[u] * (1.0 + w.dep[u]);
+        }
+        w.dep[v] = d;
+        if (v != s) w.acc[v] += d;
+    }
+    for (const Index v : w.order) { w.dist[v] = -1; w.sigma[v] = 0; w.dep[v] = 0; } // reset touched only
+}
+} // namespace
+
+// --------------------------
+// compute
+// --------------------------
+Betweenness::Result Betweenness::compute(const Graph& g) const {
+    Result res;
+    const std::size_t n = g.n();
+    res.score.assign(n, 0.0);
+    if (n < 3) return res;                                    // no vertex can lie strictly between two others
+
+    // Source set: everything, or k distinct vertices sampled uniformly.
+    std::size_t k = m_opt.samples;
+    const double delta = (m_opt.delta > 0 && m_opt.delta < 1) ? m_opt.delta : 0.1;
+    if (k == 0 && m_opt.epsilon > 0)                          // invert the Hoeffding bound
+        k = static_cast<std::size_t>(std::ceil(std::log(2.0 * n / delta) / (2.0 * m_opt.epsilon * m_opt.epsilon)));
+    std::vector<Index> sources(n);
+    std::iota(sources.begin(), sources.end(), Index(0));
+    res.exact = (k == 0 || k >= n);
+    if (!res.exact) {                                         // partial Fisher–Yates
+        std::mt19937 rng(m_opt.seed);
+        for (std::size_t i = 0; i < k; ++i)
+            std::swap(sources[i], sources[i + rng() % (n - i)]);
+        sources.resize(k);
+    }
+    res.sources = sources.size();
+
+    const Csr& adj = Csr::of(g);
+    std::vector<Worker> workers(parallel_slots(m_opt.threads));
+    parallel_for(sources.size(), 1, [&](std::size_t lo, std::size_t hi, unsigned slot){
+        Worker& w = workers[slot];
+        if (w.acc.empty()) {                                  // first source for this participant
+            w.sigma.assign(n, 0); w.dep.assign(n, 0); w.acc.assign(n, 0); w.dist.assign(n, -1);
+        }
+        for (std::size_t i = lo; i < hi; ++i) single_source(adj, sources[i], w);
+    }, m_opt.threads);
+
+    // Reduce the private accumulators; undirected graphs saw every pair twice.
+    const double scale = (res.exact ? 1.0 : static_cast<double>(n) / res.sources) * (g.directed() ? 1.0 : 0.5);
+    parallel_for(n, 4096, [&](std::size_t lo, std::size_t hi, unsigned){
+        for (std::size_t v = lo; v < hi; ++v) {
+            double sum = 0;
+            for (const auto& w : workers) if (!w.acc.empty()) sum += w.acc[v];
+            res.score[v] = sum * scale;
+        }
+    }, m_opt.threads);
+
+    if (!res.exact)
+        res.errorBound = static_cast<double>(n) * static_cast<double>(n - 2) * (g.directed() ? 1.0 : 0.5)
+                       * std::sqrt(std::log(2.0 * n / delta) / (2.0 * res.sources));
+    return res;
+}
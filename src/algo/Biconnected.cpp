@@ -0,0 +1,96 @@
+// ==========================
+// Biconnected.cpp
+// ==========================
+// Iterative Tarjan low-link DFS declared in algo/Biconnected.hpp.
+// Each stack frame remembers its vertex and the next adjacency slot to try,
+// which is exactly the state a recursive DFS would keep on the call stack.
+// An edge stack groups edges into blocks when a child closes a block.
+// ==========================
+
+#include "algo/Biconnected.hpp"  // class declaration
+#include "graph/Csr.hpp"         // undirected CSR view
+#include <algorithm>             // std::sort, std::min, std::minmax
+#include <limits>                // "undiscovered" marker
+
+namespace {
+using Index = Csr::Index;                                     // compact vertex id
+constexpr std::size_t kUnseen = std::numeric_limits<std::size_t>::max();
+
+struct Frame {
+    Index       u;                                            // vertex being expanded
+    std::size_t next;                                         // next adjacency slot of u
+    Index       parent;                                       // DFS parent (u itself for roots)
+    bool        skippedParent;                                // first u->parent slot already skipped
+};
+} // namespace
+
+// --------------------------
+// compute
+// --------------------------
+Biconnectivity::Result Biconnectivity::compute(const Graph& g) const {
+    Result res;
+    const Csr& adj = Csr::of(g, Csr::View::Symmetric);        // direction does not matter here
+    const std::size_t n = adj.n();
+
+    std::vector<std::size_t> disc(n, kUnseen), low(n, 0);     // discovery time / low-link
+    std::vector<char> cut(n, 0);                              // articulation point flags
+    std::vector<std::pair<Index, Index>> edgeStack;           // edges of the open blocks
+    std::vector<Frame> st;                                    // explicit DFS stack
+    std::size_t timer = 0;
+
+    // Pop edges down to (and including) u-v into a fresh block.
+    auto close_block = [&](Index u, Index v) {
+        const std::size_t id = res.blocks++;
+        for (;;) {
+            const auto e = edgeStack.back(); edgeStack.pop_back();
+            const auto mm = std::minmax(e.first, e.second);
+            res.edges.push_back({ mm.first, mm.second, id });
+            if (e.first == u && e.second == v) break;
+        }
+    };
+
+    for (std::size_t root = 0; root < n; ++root) {
+        if (disc[root] != kUnseen) continue;                  // already in a finished component
+        ++res.components;
+        std::size_t rootChildren = 0;                         // root is a cut vertex iff > 1 child
+        disc[root] = low[root] = timer++;
+        st.push_back({ static_cast<Index>(root), adj.offsets[root], static_cast<Index>(root), false });
+
+        while (!st.empty()) {
+            Frame& f = st.back();
+            const Index u = f.u;
+            if (f.next < adj.offsets[u + 1]) {                // try the next neighbor
+                const Index v = adj.targets[f.next++];
+                if (v == u) continue;                         // self-loop: irrelevant
+                if (v == f.parent && !f.skippedParent) { f.skippedParent = true; continue; }
+                if (disc[v] == kUnseen) {                     // tree edge: descend
+                    edgeStack.emplace_back(u, v);
+                    if (u == root) ++rootChildren;
+                    disc[v] = low[v] = timer++;
+                    st.push_back({ v, adj.offsets[v], u, false }); // invalidates f
+                } else if (disc[v] < disc[u]) {               // back edge to an ancestor
+                    edgeStack.emplace_back(u, v);
+                    low[u] = std::min(low[u], disc[v]);
+                }
+                continue;
+            }
+
+            // u is finished: propagate its low-link to the parent.
+            const Index p = f.parent;
+            st.pop_back();
+            if (st.empty()) break;                            // u was the root
+            low[p] = std::min(low[p], low[u]);
+            if (low[u] >= disc[p]) {                          // p separates u's subtree
+                if (p != root) cut[p] = 1;
+                close_block(p, u);
+            }
+            if (low[u] > disc[p])                             // no back edge around p-u
+                res.bridges.push_back(std::minmax(static_cast<Graph::Vertex>(p), static_cast<Graph::Vertex>(u)));
+        }
+        if (rootChildren > 1) cut[root] = 1;
+    }
+
+    for (std::size_t v = 0; v < n; ++v) if (cut[v]) res.articulationPoints.push_back(v);
+    std::sort(res.bridges.begin(), res.bridges.end());
+    return res;
+}
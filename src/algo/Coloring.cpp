@@ -0,0 +1,157 @@
+// ==========================
+// Coloring.cpp
+// ==========================
+// Greedy colorings declared in algo/Coloring.hpp.
+// ==========================
+
+#include "algo/Coloring.hpp"     // class declaration
+#include "algo/Parallel.hpp"     // parallel_for for Jones–Plassmann rounds
+#include "graph/Csr.hpp"         // symmetric CSR view
+#include <algorithm>             // std::sort, std::max
+#include <cstdint>               // std::uint64_t bitset words
+#include <limits>                // "uncolored" marker
+#include <queue>                 // DSatur priority queue
+#include <tuple>                 // DSatur keys
+
+namespace {
+using Index = Csr::Index;                                     // compact vertex id
+constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+
+// Growable bitset of colors taken by the current vertex's neighbors.
+class FreeColors {
+public:
+    void mark(std::size_t c) {
+        if (c / 64 >= m_w.size()) m_w.resize(c / 64 + 1, 0);
+        m_w[c / 64] |= std::uint64_t(1) << (c % 64);
+    }
+    void unmark(std::size_t c) { m_w[c / 64] &= ~(std::uint64_t(1) << (c % 64)); } // c was marked
+    std::size_t first() const {
+        for (std::size_t w = 0; w < m_w.size(); ++w)
+            if (~m_w[w]) return w * 64 + static_cast<std::size_t>(__builtin_ctzll(~m_w[w]));
+        return m_w.size() * 64;
+    }
+
+private:
+    std::vector<std::uint64_t> m_w;
+};
+
+// Smallest color not used by a neighbor of v; leaves `fc` empty again.
+std::size_t smallest_free(const Csr& adj, Index v, const std::vector<std::size_t>& color, FreeColors& fc) {
+    for (std::size_t p = adj.offsets[v]; p < adj.offsets[v + 1]; ++p)
+        if (color[adj.targets[p]] != kNone) fc.mark(color[adj.targets[p]]);
+    const std::size_t c = fc.first();
+    for (std::size_t p = adj.offsets[v]; p < adj.offsets[v + 1]; ++p)
+        if (color[adj.targets[p]] != kNone) fc.unmark(color[adj.targets[p]]);
+    return c;
+}
+
+// SplitMix64 finaliser: cheap, well-mixed per-vertex priorities.
+std::uint64_t mix(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+void largest_first(const Csr& adj, std::vector<std::size_t>& color) {
+    std::vector<Index> order(adj.n());
+    for (std::size_t v = 0; v < order.size(); ++v) order[v] = static_cast<Index>(v);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](Index a, Index b){ return adj.degree(a) > adj.degree(b); });
+    FreeColors fc;
+    for (const Index v : order) color[v] = smallest_free(adj, v, color, fc);
+}
+
+// Saturation is tracked exactly: colors up to deg(u) live in a per-vertex
+// bit range of one flat arena (O(m) bits in total); a larger color can only
+// come from few neighbors, so it is checked by scanning u's adjacency.
+void dsatur(const Csr& adj, std::vector<std::size_t>& color) {
+    const std::size_t n = adj.n();
+    std::vector<std::size_t> sat(n, 0), off(n + 1, 0), stamp(n, kNone);
+    for (std::size_t v = 0; v < n; ++v) off[v + 1] = off[v] + (adj.degree(v) + 1 + 63) / 64;
+    std::vector<std::uint64_t> seen(off[n], 0);
+
+    using Key = std::tuple<std::size_t, std::size_t, std::size_t>; // (sat, degree, n-1-v)
+    std::priority_queue<Key> pq;
+    for (std::size_t v = 0; v < n; ++v) pq.emplace(0, adj.degree(v), n - 1 - v);
+
+    FreeColors fc;
+    while (!pq.empty()) {
+        const auto top = pq.top(); pq.pop();
+        const std::size_t v = n - 1 - std::get<2>(top);
+        if (color[v] != kNone || std::get<0>(top) != sat[v]) continue; // stale key
+        const std::size_t c = smallest_free(adj, static_cast<Index>(v), color, fc);
+        color[v] = c;
+        for (std::size_t p = adj.offsets[v]; p < adj.offsets[v + 1]; ++p) {
+            const std::size_t u = adj.targets[p];
+            if (color[u] != kNone || stamp[u] == v) continue;  // colored, or a parallel arc
+            stamp[u] = v;
+            bool fresh;
+            if (c <= adj.degree(u)) {
+                std::uint64_t& w = seen[off[u] + c / 64];
+                const std::uint64_t bit = std::uint64_t(1) << (c % 64);
+                fresh = !(w & bit); w |= bit;
+            } else {
+                fresh = true;
+                for (std::size_t q = adj.offsets[u]; q < adj.offsets[u + 1] && fresh; ++q)
+                    fresh = adj.targets[q] == v || color[adj.targets[q]] != c;
+            }
+            if (fresh) pq.emplace(++sat[u], adj.degree(u), n - 1 - u);
+        }
+    }
+}
+
+std::size_t jones_plassmann(const Csr& adj, std::vector<std::size_t>& color, unsigned seed, unsigned threads) {
+    const std::size_t n = adj.n();
+    std::vector<std::uint64_t> prio(n);
+    for (std::size_t v = 0; v < n; ++v) prio[v] = mix(v ^ (std::uint64_t(seed) << 32));
+    auto beats = [&](std::size_t a, std::size_t b) { return prio[a] > prio[b] || (prio[a] == prio[b] && a < b); };
+
+    std::vector<Index> remaining(n);
+    for (std::size_t v = 0; v < n; ++v) remaining[v] = static_cast<Index>(v);
+    std::vector<char> win;
+    std::vector<FreeColors> scratch(parallel_slots(threads));
+    std::size_t rounds = 0;
+
+    while (!remaining.empty()) {
+        ++rounds;
+        win.assign(remaining.size(), 0);
+        parallel_for(remaining.size(), 1024, [&](std::size_t lo, std::size_t hi, unsigned){
+            for (std::size_t i = lo; i < hi; ++i) {           // local maxima among uncolored vertices
+                const Index v = remaining[i];
+                bool best = true;
+                for (std::size_t p = adj.offsets[v]; p < adj.offsets[v + 1] && best; ++p) {
+                    const Index u = adj.targets[p];
+                    best = u == v || color[u] != kNone || beats(v, u);
+                }
+                win[i] = best;
+            }
+        }, threads);
+        parallel_for(remaining.size(), 1024, [&](std::size_t lo, std::size_t hi, unsigned slot){
+            for (std::size_t i = lo; i < hi; ++i)             // winners are pairwise non-adjacent
+                if (win[i]) color[remaining[i]] = smallest_free(adj, remaining[i], color, scratch[slot]);
+        }, threads);
+        std::size_t keep = 0;
+        for (std::size_t i = 0; i < remaining.size(); ++i)
+            if (!win[i]) remaining[keep++] = remaining[i];
+        remaining.resize(keep);
+    }
+    return rounds;
+}
+} // namespace
+
+// --------------------------
+// compute
+// --------------------------
+GraphColoring::Result GraphColoring::compute(const Graph& g) const {
+    Result res;
+    const Csr& adj = Csr::of(g, Csr::View::Symmetric);        // direction does not matter
+    res.color.assign(adj.n(), kNone);
+    switch (m_opt.method) {
+    case Method::LargestFirst:   largest_first(adj, res.color); break;
+    case Method::DSatur:         dsatur(adj, res.color); break;
+    case Method::JonesPlassmann: res.rounds = jones_plassmann(adj, res.color, m_opt.seed, m_opt.threads); break;
+    }
+    for (const std::size_t c : res.color) res.colors = std::max(res.colors, c + 1);
+    return res;
+}
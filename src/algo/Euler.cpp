@@ -111,8 +111,8 @@ static std::string euler_directed(const Graph& g) {
     const std::size_t n = g.n();                                  // number of vertices
 
     // 1) In-degree equals out-degree for every vertex
-    std::vector<std::size_t> out = g.outDegree();                 // out-degrees
-    std::vector<std::size_t> in  = g.inDegree();                  // in-degrees
+    const auto& out = g.outDegree();                              // out-degrees (cached)
+    const auto& in  = g.inDegree();                               // in-degrees (cached)
     Graph::Vertex start = n;                                      // start at a vertex with out>0
     for (Graph::Vertex u = 0; u < n; ++u) {                       
         if (in[u] != out[u])                                      // mismatch violates the condition
@@ -125,7 +125,7 @@ static std::string euler_directed(const Graph& g) {
     //    We check reachability in both directions: G and G^R starting from 'start'
     std::vector<bool> seenF(n, false);                            // seen in forward graph
     dfs_directed(start, g, seenF);                                 // DFS following arcs
-    Graph gr = g.reversed();                                      // reversed graph
+    const Graph& gr = g.reversedView();                           // reversed graph (shared, cached)
     std::vector<bool> seenR(n, false);                            // seen in reverse graph
     dfs_directed(start, gr, seenR);                                // DFS in reversed arcs
 
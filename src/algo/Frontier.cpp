@@ -0,0 +1,100 @@
+// ==========================
+// Frontier.cpp
+// ==========================
+// VertexSubset representation changes and the non-template helpers of the
+// vertexMap / edgeMap engine declared in algo/Frontier.hpp.
+// ==========================
+
+#include "algo/Frontier.hpp"     // VertexSubset, FrontierGraph, edgeMap
+#include <algorithm>             // std::find
+
+// --------------------------
+// VertexSubset
+// --------------------------
+VertexSubset VertexSubset::single(std::size_t n, Index v) {
+    return fromIds(n, {v});
+}
+
+VertexSubset VertexSubset::all(std::size_t n) {
+    return fromFlags(std::vector<std::uint8_t>(n, 1), n);
+}
+
+VertexSubset VertexSubset::fromIds(std::size_t n, std::vector<Index> ids) {
+    VertexSubset s(n);
+    s.m_count = ids.size();
+    s.m_ids = std::move(ids);
+    return s;
+}
+
+VertexSubset VertexSubset::fromFlags(std::vector<std::uint8_t> flags, std::size_t count) {
+    VertexSubset s(flags.size());
+    s.m_count = count;
+    s.m_dense = true;
+    s.m_flags = std::move(flags);
+    return s;
+}
+
+void VertexSubset::toDense(unsigned maxThreads) {
+    if (m_dense) return;
+    m_flags.assign(m_n, 0);
+    parallel_for(m_ids.size(), kFrontierGrain, [&](std::size_t lo, std::size_t hi, unsigned) {
+        for (std::size_t i = lo; i < hi; ++i) m_flags[m_ids[i]] = 1;   // distinct ids: no two writers
+    }, maxThreads);
+    m_ids.clear();
+    m_ids.shrink_to_fit();
+    m_dense = true;
+}
+
+void VertexSubset::toSparse(unsigned maxThreads) {
+    if (!m_dense) return;
+    // Per-chunk lists concatenated in chunk order keep the ids ascending.
+    const std::size_t chunks = (m_n + kFrontierGrain - 1) / kFrontierGrain;
+    std::vector<std::vector<Index>> parts(chunks);
+    parallel_for(m_n, kFrontierGrain, [&](std::size_t lo, std::size_t hi, unsigned) {
+        auto& part = parts[lo / kFrontierGrain];
+        for (std::size_t v = lo; v < hi; ++v)
+            if (m_flags[v]) part.push_back(static_cast<Index>(v));
+    }, maxThreads);
+    m_ids.clear();
+    m_ids.reserve(m_count);
+    for (const auto& part : parts) m_ids.insert(m_ids.end(), part.begin(), part.end());
+    m_flags.clear();
+    m_flags.shrink_to_fit();
+    m_dense = false;
+}
+
+bool VertexSubset::contains(Index v) const {
+    if (m_dense) return v < m_n && m_flags[v];
+    return std::find(m_ids.begin(), m_ids.end(), v) != m_ids.end();
+}
+
+// --------------------------
+// FrontierGraph / edgeMap helpers
+// --------------------------
+FrontierGraph FrontierGraph::of(const Graph& g) {
+    const Csr& out = Csr::of(g);
+    return FrontierGraph{ out, g.directed() ? Csr::of(g, Csr::View::In) : out };
+}
+
+std::size_t frontier_out_degree(const FrontierGraph& G, const VertexSubset& U, unsigned maxThreads) {
+    std::vector<std::size_t> sums(parallel_slots(maxThreads), 0);
+    if (U.dense()) {
+        if (U.size() == U.n()) return G.out.arcs();                        // everyone
+        const auto& in = U.flags();
+        parallel_for(U.n(), kFrontierGrain, [&](std::size_t lo, std::size_t hi, unsigned slot) {
+            std::size_t s = 0;
+            for (std::size_t v = lo; v < hi; ++v) if (in[v]) s += G.out.degree(v);
+            sums[slot] += s;
+        }, maxThreads);
+    } else {
+        const auto& ids = U.ids();
+        parallel_for(ids.size(), kFrontierGrain, [&](std::size_t lo, std::size_t hi, unsigned slot) {
+            std::size_t s = 0;
+            for (std::size_t i = lo; i < hi; ++i) s += G.out.degree(ids[i]);
+            sums[slot] += s;
+        }, maxThreads);
+    }
+    std::size_t total = 0;
+    for (std::size_t s : sums) total += s;
+    return total;
+}
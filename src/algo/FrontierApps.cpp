@@ -0,0 +1,161 @@
+// ==========================
+// FrontierApps.cpp
+// ==========================
+// BFS, connected components and PageRank written on the vertexMap /
+// edgeMap engine (algo/Frontier.hpp), declared in algo/FrontierApps.hpp.
+// Each algorithm is an update functor plus a short round loop; parallelism,
+// push/pull switching and frontier bookkeeping live in the engine.
+// ==========================
+
+#include "algo/FrontierApps.hpp" // FrontierBfs, FrontierComponents, FrontierPageRank
+#include <chrono>                // per-iteration timing
+#include <cmath>                 // std::fabs
+#include <stdexcept>             // std::out_of_range
+
+namespace {
+
+using Index = VertexSubset::Index;
+constexpr Index kNone = static_cast<Index>(-1);
+
+// --------------------------
+// BFS: the first source to claim v becomes its parent
+// --------------------------
+struct BfsF {
+    std::vector<std::atomic<Index>>& parent;
+
+    bool cond(Index v) const { return parent[v].load(std::memory_order_relaxed) == kNone; }
+    bool update(Index u, Index v) { parent[v].store(u, std::memory_order_relaxed); return true; }
+    bool updateAtomic(Index u, Index v) { return compare_and_swap(parent[v], kNone, u); }
+};
+
+// --------------------------
+// PageRank: gather rank/outdeg of every in-neighbor
+// --------------------------
+struct PageRankF {
+    const std::vector<double>&        contrib;   // rank[u] / outdeg(u)
+    std::vector<std::atomic<double>>& sum;       // gathered mass per vertex
+
+    bool cond(Index) const { return true; }
+    bool update(Index u, Index v) {
+        sum[v].store(sum[v].load(std::memory_order_relaxed) + contrib[u], std::memory_order_relaxed);
+        return true;
+    }
+    bool updateAtomic(Index u, Index v) { write_add(sum[v], contrib[u]); return true; }
+};
+
+} // namespace
+
+FrontierBfs::Result FrontierBfs::compute(const Graph& g, Graph::Vertex source) const {
+    const std::size_t n = g.n();
+    if (source >= n) throw std::out_of_range("BFS source out of range");
+    const FrontierGraph G = FrontierGraph::of(g);
+
+    Result r;
+    std::vector<std::atomic<Index>> parent(n);
+    vertexMap(VertexSubset::all(n), [&](Index v) { parent[v].store(kNone, std::memory_order_relaxed); }, m_opt.threads);
+    parent[source] = static_cast<Index>(source);                     // claimed: never updated
+    r.level.assign(n, -1);
+    r.level[source] = 0;
+
+    VertexSubset frontier = VertexSubset::single(n, static_cast<Index>(source));
+    BfsF f{parent};
+    for (long long depth = 1; !frontier.empty(); ++depth) {
+        frontier = edgeMap(G, frontier, f, m_opt);
+        ++r.rounds;
+        if (frontier.dense()) ++r.denseRounds;
+        vertexMap(frontier, [&](Index v) { r.level[v] = depth; }, m_opt.threads);
+    }
+
+    r.parent.assign(n, -1);
+    for (std::size_t v = 0; v < n; ++v) {
+        if (r.level[v] < 0) continue;
+        ++r.reached;
+        if (v != source) r.parent[v] = parent[v].load(std::memory_order_relaxed);
+    }
+    return r;
+}
+
+bool MinLabelF::update(Index u, Index v) {
+    const Index lu = label[u].load(std::memory_order_relaxed);
+    if (lu >= label[v].load(std::memory_order_relaxed)) return false;
+    label[v].store(lu, std::memory_order_relaxed);
+    return true;                                                     // pull output flags dedupe v
+}
+
+bool MinLabelF::updateAtomic(Index u, Index v) {
+    return write_min(label[v], label[u].load(std::memory_order_relaxed))
+        && compare_and_swap(claimed[v], std::uint8_t{0}, std::uint8_t{1});  // first lowering this round
+}
+
+FrontierComponents::Result FrontierComponents::compute(const Graph& g) const {
+    const std::size_t n = g.n();
+    const Csr& sym = Csr::of(g, Csr::View::Symmetric);              // direction ignored
+    const FrontierGraph G{sym, sym};
+
+    Result r;
+    std::vector<std::atomic<Index>> label(n);
+    std::vector<std::atomic<std::uint8_t>> claimed(n);
+    VertexSubset frontier = VertexSubset::all(n);
+    vertexMap(frontier, [&](Index v) {
+        label[v].store(v, std::memory_order_relaxed);
+        claimed[v].store(0, std::memory_order_relaxed);
+    }, m_opt.threads);
+
+    MinLabelF f{label, claimed};
+    while (!frontier.empty()) {
+        frontier = edgeMap(G, frontier, f, m_opt);
+        vertexMap(frontier, [&](Index v) { claimed[v].store(0, std::memory_order_relaxed); }, m_opt.threads);
+        ++r.rounds;
+    }
+
+    r.label.resize(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        r.label[v] = label[v].load(std::memory_order_relaxed);
+        if (r.label[v] == v) ++r.components;
+    }
+    return r;
+}
+
+PageRank::Result FrontierPageRank::compute(const Graph& g) const {
+    PageRank::Result res;
+    const std::size_t n = g.n();
+    if (n == 0) { res.converged = true; return res; }
+    const FrontierGraph G = FrontierGraph::of(g);
+    const unsigned threads = m_opt.threads;
+    const double d = m_opt.damping, invN = 1.0 / static_cast<double>(n);
+
+    const VertexSubset everyone = VertexSubset::all(n);
+    const VertexSubset dangling = vertexFilter(everyone, [&](Index v) { return G.out.degree(v) == 0; }, threads);
+    std::vector<double> rank(n, invN), contrib(n);
+    std::vector<std::atomic<double>> sum(n);
+    PageRankF f{contrib, sum};
+    EdgeMapOptions opt;
+    opt.output  = false;
+    opt.threads = threads;
+
+    for (std::size_t it = 0; it < m_opt.maxIterations; ++it) {
+        const auto t0 = std::chrono::steady_clock::now();
+        const double base = (1.0 - d) * invN + d * invN * vertexSum<double>(dangling, [&](Index v) { return rank[v]; }, threads);
+        vertexMap(everyone, [&](Index v) {
+            const std::size_t deg = G.out.degree(v);
+            contrib[v] = deg ? rank[v] / static_cast<double>(deg) : 0.0;
+            sum[v].store(0.0, std::memory_order_relaxed);
+        }, threads);
+
+        VertexSubset all = everyone;                                 // edgeMap may convert its input
+        edgeMap(G, all, f, opt);
+
+        res.residual = vertexSum<double>(everyone, [&](Index v) {
+            const double next = base + d * sum[v].load(std::memory_order_relaxed);
+            const double delta = std::fabs(next - rank[v]);
+            rank[v] = next;
+            return delta;
+        }, threads);
+
+        res.iterationMs.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count());
+        res.iterations = it + 1;
+        if (res.residual < m_opt.tolerance) { res.converged = true; break; }
+    }
+    res.rank = std::move(rank);
+    return res;
+}
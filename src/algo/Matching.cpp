@@ -0,0 +1,215 @@
+// ==========================
+// Matching.cpp
+// ==========================
+// Bipartiteness check + Hopcroft–Karp declared in algo/Matching.hpp.
+//   1) parallel BFS 2-coloring over the undirected view (Csr::View::Symmetric)
+//   2) optional greedy / Karp–Sipser seeding
+//   3) Hopcroft–Karp phases: BFS layers from free left vertices, then
+//      vertex-disjoint shortest augmenting paths via an explicit-stack DFS
+// ==========================
+
+#include "algo/Matching.hpp"     // class declaration
+#include "algo/Parallel.hpp"     // parallel_for for the BFS frontier
+#include "graph/Csr.hpp"         // undirected CSR view
+#include <atomic>                // colors claimed with CAS
+#include <limits>                // unreached distance marker
+
+namespace {
+
+using Index = Csr::Index;                                    // compact vertex id
+constexpr int kNone = -1;                                    // "unmatched" marker
+constexpr std::size_t kGrain = 512;                          // frontier vertices per chunk
+
+// ---------- 1) level-synchronous BFS coloring ----------
+bool color_graph(const Csr& adj, unsigned threads, BipartiteMatching::Result& res) {
+    const std::size_t n = adj.n();
+    std::vector<std::atomic<signed char>> color(n);          // -1 = uncolored
+    for (auto& c : color) c.store(-1, std::memory_order_relaxed);
+
+    const unsigned slots = parallel_slots(threads);
+    std::vector<std::vector<Index>> nextBySlot(slots);       // per-participant next frontier
+    std::atomic<bool> odd{false};                            // conflict seen
+    std::atomic<std::size_t> witness{0};                     // packed conflict edge (u*n+v)
+
+    std::vector<Index> frontier;
+    for (std::size_t root = 0; root < n && !odd.load(); ++root) {
+        if (color[root].load(std::memory_order_relaxed) != -1) continue; // already in a colored component
+        color[root].store(0, std::memory_order_relaxed);
+        frontier.assign(1, static_cast<Index>(root));
+
+        while (!frontier.empty() && !odd.load()) {
+            parallel_for(frontier.size(), kGrain, [&](std::size_t lo, std::size_t hi, unsigned slot){
+                auto& out = nextBySlot[slot];
+                for (std::size_t i = lo; i < hi; ++i) {
+                    const Index u = frontier[i];
+                    const signed char cu = color[u].load(std::memory_order_relaxed);
+                    for (std::size_t p = adj.offsets[u]; p < adj.offsets[u + 1]; ++p) {
+                        const Index v = adj.targets[p];
+                        signed char expect = -1;
+                        if (color[v].compare_exchange_strong(expect, static_cast<signed char>(1 - cu),
+                                                             std::memory_order_relaxed)) {
+                            out.push_back(v);                        // we colored v: it joins the next level
+                        } else if (expect == cu) {                   // same color on both ends
+                            if (!odd.exchange(true)) witness.store(std::size_t(u) * n + v);
+                        }
+                    }
+                }
+            }, threads);
+
+            frontier.clear();                                        // merge per-slot frontiers
+            for (auto& part : nextBySlot) { frontier.insert(frontier.end(), part.begin(), part.end()); part.clear(); }
+        }
+    }
+
+    if (odd.load()) {
+        const std::size_t w = witness.load();
+        res.conflict = { w / n, w % n };
+        return false;
+    }
+    res.side.resize(n);
+    for (std::size_t v = 0; v < n; ++v) res.side[v] = color[v].load(std::memory_order_relaxed);
+    return true;
+}
+
+// ---------- 2a) greedy: first free neighbor of each left vertex ----------
+std::size_t seed_greedy(const Csr& adj, const std::vector<signed char>& side, std::vector<int>& mate) {
+    std::size_t made = 0;
+    for (std::size_t u = 0; u < adj.n(); ++u) {
+        if (side[u] != 0 || mate[u] != kNone) continue;
+        for (std::size_t p = adj.offsets[u]; p < adj.offsets[u + 1]; ++p) {
+            const Index v = adj.targets[p];
+            if (mate[v] == kNone) { mate[u] = static_cast<int>(v); mate[v] = static_cast<int>(u); ++made; break; }
+        }
+    }
+    return made;
+}
+
+// ---------- 2b) Karp–Sipser: forced degree-1 matches first, then greedy ----------
+std::size_t seed_karp_sipser(const Csr& adj, std::vector<int>& mate) {
+    const std::size_t n = adj.n();
+    std::vector<std::size_t> deg(n);                          // live (unmatched-neighbor) degree
+    std::vector<Index> ones;                                  // vertices with live degree 1
+    for (std::size_t u = 0; u < n; ++u) {
+        deg[u] = adj.degree(u);
+        if (deg[u] == 1) ones.push_back(static_cast<Index>(u));
+    }
+
+    std::size_t made = 0;
+    auto retire = [&](Index x) {                              // x got matched: neighbors lose a candidate
+        for (std::size_t p = adj.offsets[x]; p < adj.offsets[x + 1]; ++p) {
+            const Index w = adj.targets[p];
+            if (mate[w] == kNone && deg[w] > 0 && --deg[w] == 1) ones.push_back(w);
+        }
+    };
+    auto match = [&](Index u, Index v) {
+        mate[u] = static_cast<int>(v); mate[v] = static_cast<int>(u); ++made;
+        retire(u); retire(v);
+    };
+    auto free_neighbor = [&](Index u) -> int {
+        for (std::size_t p = adj.offsets[u]; p < adj.offsets[u + 1]; ++p)
+            if (mate[adj.targets[p]] == kNone) return static_cast<int>(adj.targets[p]);
+        return kNone;
+    };
+
+    std::size_t scan = 0;                                     // cursor for the greedy fallback
+    for (;;) {
+        while (!ones.empty()) {                               // degree-1 rule is always safe
+            const Index u = ones.back(); ones.pop_back();
+            if (mate[u] != kNone) continue;
+            const int v = free_neighbor(u);
+            if (v != kNone) match(u, static_cast<Index>(v));
+        }
+        while (scan < n && (mate[scan] != kNone || free_neighbor(static_cast<Index>(scan)) == kNone)) ++scan;
+        if (scan == n) break;                                 // nothing left to match
+        const Index u = static_cast<Index>(scan);
+        match(u, static_cast<Index>(free_neighbor(u)));       // arbitrary edge when no forced move
+    }
+    return made;
+}
+
+// ---------- 3) Hopcroft–Karp ----------
+std::size_t hopcroft_karp(const Csr& adj, const std::vector<signed char>& side,
+                          std::vector<int>& mate, std::size_t& phases) {
+    const std::size_t n = adj.n();
+    const std::size_t kInf = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> dist(n);                         // BFS layer of left vertices
+    std::vector<std::size_t> it(n);                           // per-vertex edge cursor for DFS
+    std::vector<Index> queue; queue.reserve(n);
+    std::size_t gained = 0;
+
+    for (;;) {
+        // BFS from all free left vertices; alternate free edge / matched edge.
+        queue.clear();
+        std::size_t limit = kInf;                             // layer of the shortest augmenting paths
+        for (std::size_t u = 0; u < n; ++u) {
+            if (side[u] == 0 && mate[u] == kNone) { dist[u] = 0; queue.push_back(static_cast<Index>(u)); }
+            else dist[u] = kInf;
+        }
+        for (std::size_t h = 0; h < queue.size(); ++h) {
+            const Index u = queue[h];
+            if (dist[u] >= limit) continue;                   // deeper layers cannot be shortest
+            for (std::size_t p = adj.offsets[u]; p < adj.offsets[u + 1]; ++p) {
+                const int w = mate[adj.targets[p]];           // follow the matched edge back to the left
+                if (w == kNone) limit = dist[u];              // free right vertex: path ends here
+                else if (dist[w] == kInf) { dist[w] = dist[u] + 1; queue.push_back(static_cast<Index>(w)); }
+            }
+        }
+        if (limit == kInf) break;                             // no augmenting path: matching is maximum
+        ++phases;
+
+        // DFS along layered edges; each vertex's cursor only moves forward,
+        // so a phase costs O(E) and the paths found are vertex-disjoint.
+        for (std::size_t u = 0; u < n; ++u) it[u] = adj.offsets[u];
+        std::vector<Index> path;                              // left vertices on the current path
+        for (std::size_t root = 0; root < n; ++root) {
+            if (side[root] != 0 || mate[root] != kNone || dist[root] != 0) continue;
+            path.assign(1, static_cast<Index>(root));
+            while (!path.empty()) {
+                const Index u = path.back();
+                if (it[u] == adj.offsets[u + 1]) {            // dead end: drop u from this phase
+                    dist[u] = kInf;
+                    path.pop_back();
+                    continue;
+                }
+                const Index v = adj.targets[it[u]++];
+                const int w = mate[v];
+                if (w == kNone) {                             // free right vertex: augment along path
+                    Index right = v;
+                    for (std::size_t k = path.size(); k-- > 0; ) {
+                        const Index left = path[k];
+                        const int prev = mate[left];
+                        mate[left] = static_cast<int>(right);
+                        mate[right] = static_cast<int>(left);
+                        right = static_cast<Index>(prev);
+                    }
+                    ++gained;
+                    break;
+                }
+                if (dist[w] == dist[u] + 1) path.push_back(static_cast<Index>(w)); // descend one layer
+            }
+        }
+    }
+    return gained;
+}
+
+} // namespace
+
+// --------------------------
+// compute
+// --------------------------
+BipartiteMatching::Result BipartiteMatching::compute(const Graph& g) const {
+    Result res;
+    const Csr& adj = Csr::of(g, Csr::View::Symmetric);        // direction is irrelevant for matching
+    res.bipartite = color_graph(adj, m_opt.threads, res);
+    if (!res.bipartite) return res;
+
+    std::vector<int> mate(g.n(), kNone);                      // partner per vertex
+    if (m_opt.init == Init::Greedy)          res.initialSize = seed_greedy(adj, res.side, mate);
+    else if (m_opt.init == Init::KarpSipser) res.initialSize = seed_karp_sipser(adj, mate);
+
+    res.size = res.initialSize + hopcroft_karp(adj, res.side, mate, res.phases);
+    for (std::size_t u = 0; u < g.n(); ++u)                   // report (side-0, side-1) pairs
+        if (res.side[u] == 0 && mate[u] != kNone)
+            res.pairs.emplace_back(u, static_cast<Graph::Vertex>(mate[u]));
+    return res;
+}
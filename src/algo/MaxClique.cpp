@@ -0,0 +1,190 @@
+// ==========================
+// MaxClique.cpp
+// ==========================
+// Bitset branch and bound declared in algo/MaxClique.hpp.
+// Vertex ids inside the search are positions in the initial coloring order,
+// so "candidates before branch i" is simply the bit range [0, i).
+// ==========================
+
+#include "algo/MaxClique.hpp"    // class declaration
+#include "algo/Parallel.hpp"     // parallel_for over top-level branches
+#include "graph/Csr.hpp"         // symmetric CSR view
+#include <algorithm>             // std::stable_sort, std::sort, std::max
+#include <atomic>                // shared incumbent / stop flag
+#include <cstdint>               // std::uint64_t words
+#include <memory>                // per-participant searchers
+#include <mutex>                 // guards the incumbent's vertex list
+#include <stdexcept>             // std::length_error
+
+namespace {
+using Word  = std::uint64_t;
+using Index = Csr::Index;
+constexpr std::size_t kPollEvery = 1024;                      // search nodes between cancel polls
+
+inline void reset(Word* s, std::size_t v) { s[v / 64] &= ~(Word(1) << (v % 64)); }
+
+// Rows of n*W words: bit u of row v set iff u-v is an edge (u != v).
+std::vector<Word> build_rows(const Csr& adj, const std::vector<Index>& id, std::size_t W) {
+    std::vector<Word> rows(adj.n() * W, 0);
+    for (std::size_t v = 0; v < adj.n(); ++v)
+        for (std::size_t p = adj.offsets[v]; p < adj.offsets[v + 1]; ++p) {
+            const std::size_t u = adj.targets[p];
+            if (u != v) rows[std::size_t(id[v]) * W + id[u] / 64] |= Word(1) << (id[u] % 64);
+        }
+    return rows;
+}
+
+// Greedy sequential coloring of the set P (lowest id first): vertices come
+// out grouped by color class, bound[i] = color of order[i] (1-based), so
+// bound[i] bounds the largest clique inside order[0..i].
+std::size_t color_sort(const Word* P, const Word* rows, std::size_t W,
+                       std::vector<Index>& order, std::vector<std::size_t>& bound,
+                       std::vector<Word>& U, std::vector<Word>& Q) {
+    order.clear(); bound.clear();
+    std::copy(P, P + W, U.begin());
+    std::size_t color = 0;
+    for (std::size_t first = 0; first < W; ) {
+        if (!U[first]) { ++first; continue; }                 // skip exhausted prefix words
+        ++color;
+        std::copy(U.begin(), U.end(), Q.begin());
+        for (std::size_t w = first; w < W; ) {                // build one independent color class
+            if (!Q[w]) { ++w; continue; }
+            const std::size_t v = w * 64 + static_cast<std::size_t>(__builtin_ctzll(Q[w]));
+            reset(U.data(), v); reset(Q.data(), v);
+            const Word* nv = rows + v * W;
+            for (std::size_t x = w; x < W; ++x) Q[x] &= ~nv[x]; // drop v's neighbors from the class
+            order.push_back(static_cast<Index>(v)); bound.push_back(color);
+        }
+    }
+    return color;
+}
+
+struct Incumbent {
+    std::atomic<std::size_t> size{0};                         // read lock-free by every node
+    std::mutex mu;                                            // guards `clique`
+    std::vector<Index> clique;
+    std::atomic<bool> stop{false};                            // deadline hit / cancelled
+    std::atomic<std::size_t> nodes{0};
+
+    void offer(const std::vector<Index>& c) {
+        if (c.size() <= size.load(std::memory_order_relaxed)) return;
+        std::lock_guard<std::mutex> lk(mu);
+        if (c.size() <= size.load(std::memory_order_relaxed)) return;
+        clique = c;
+        size.store(c.size(), std::memory_order_relaxed);
+    }
+};
+
+// One participant's search state; buffers are reused across branches.
+class Searcher {
+public:
+    Searcher(const Word* rows, std::size_t W, std::size_t depth, Incumbent& inc, const CancelToken& cancel)
+        : m_rows(rows), m_W(W), m_inc(inc), m_cancel(cancel),
+          m_P(depth + 2, std::vector<Word>(W)), m_order(depth + 2), m_bound(depth + 2), m_U(W), m_Q(W) {}
+
+    // Branch on top-level vertex v with candidates N(v) ∩ [0, v).
+    void branch(std::size_t v) {
+        Word* P = m_P[1].data();
+        const Word* nv = m_rows + v * m_W;
+        bool any = false;
+        for (std::size_t w = 0; w < m_W; ++w) {
+            const std::size_t lo = w * 64;
+            const Word below = lo + 64 <= v ? ~Word(0) : (lo >= v ? 0 : (Word(1) << (v - lo)) - 1);
+            P[w] = nv[w] & below; any |= P[w] != 0;
+        }
+        m_C.assign(1, static_cast<Index>(v));
+        if (!any) m_inc.offer(m_C);
+        else expand(1);
+        m_inc.nodes.fetch_add(m_nodes, std::memory_order_relaxed);
+        m_nodes = 0;
+    }
+
+private:
+    void expand(std::size_t depth) {
+        if (++m_nodes % kPollEvery == 0 && m_cancel.expired()) m_inc.stop.store(true, std::memory_order_relaxed);
+        if (m_inc.stop.load(std::memory_order_relaxed)) return;
+
+        Word* P = m_P[depth].data();
+        auto& order = m_order[depth];
+        auto& bound = m_bound[depth];
+        color_sort(P, m_rows, m_W, order, bound, m_U, m_Q);
+        Word* NP = m_P[depth + 1].data();
+        for (std::size_t i = order.size(); i-- > 0; ) {
+            if (m_C.size() + bound[i] <= m_inc.size.load(std::memory_order_relaxed)) return; // colors cannot beat it
+            const std::size_t v = order[i];
+            const Word* nv = m_rows + v * m_W;
+            Word any = 0;
+            for (std::size_t w = 0; w < m_W; ++w) { NP[w] = P[w] & nv[w]; any |= NP[w]; }
+            m_C.push_back(static_cast<Index>(v));
+            if (!any) m_inc.offer(m_C);
+            else expand(depth + 1);
+            m_C.pop_back();
+            if (m_inc.stop.load(std::memory_order_relaxed)) return;
+            reset(P, v);                                      // v's subtree is done
+        }
+    }
+
+    const Word* m_rows;
+    std::size_t m_W;
+    Incumbent& m_inc;
+    const CancelToken& m_cancel;
+    std::vector<std::vector<Word>> m_P;                       // candidate set per depth
+    std::vector<std::vector<Index>> m_order;                  // color order per depth
+    std::vector<std::vector<std::size_t>> m_bound;            // color bound per depth
+    std::vector<Word> m_U, m_Q;                               // color_sort scratch
+    std::vector<Index> m_C;                                   // current clique
+    std::size_t m_nodes = 0;
+};
+} // namespace
+
+// --------------------------
+// compute
+// --------------------------
+MaxClique::Result MaxClique::compute(const Graph& g) const {
+    Result res;
+    const std::size_t n = g.n();
+    if (n > m_opt.maxVertices) throw std::length_error("graph too large for the bitset clique search");
+    if (n == 0) return res;
+
+    const Csr& adj = Csr::of(g, Csr::View::Symmetric);
+    const std::size_t W = (n + 63) / 64;
+
+    // Initial order: degree-descending, then regrouped by greedy color class.
+    std::vector<Index> byDeg(n);
+    for (std::size_t v = 0; v < n; ++v) byDeg[v] = static_cast<Index>(v);
+    std::stable_sort(byDeg.begin(), byDeg.end(), [&](Index a, Index b){ return adj.degree(a) > adj.degree(b); });
+    std::vector<Index> id(n);
+    for (std::size_t i = 0; i < n; ++i) id[byDeg[i]] = static_cast<Index>(i);
+
+    std::vector<Index> order; std::vector<std::size_t> bound;
+    std::vector<Word> U(W), Q(W), all(W, ~Word(0));
+    if (n % 64) all[W - 1] = (Word(1) << (n % 64)) - 1;
+    {
+        const auto rows = build_rows(adj, id, W);
+        res.colorBound = color_sort(all.data(), rows.data(), W, order, bound, U, Q);
+    }
+    std::vector<Index> original(n);                           // search id → vertex
+    for (std::size_t i = 0; i < n; ++i) original[i] = byDeg[order[i]];
+    for (std::size_t i = 0; i < n; ++i) id[original[i]] = static_cast<Index>(i);
+    const auto rows = build_rows(adj, id, W);
+
+    Incumbent inc;
+    std::vector<std::unique_ptr<Searcher>> searchers(parallel_slots(m_opt.threads));
+    parallel_for(n, 1, [&](std::size_t lo, std::size_t hi, unsigned slot){
+        auto& s = searchers[slot];
+        if (!s) s = std::make_unique<Searcher>(rows.data(), W, res.colorBound, inc, m_opt.cancel);
+        for (std::size_t j = lo; j < hi; ++j) {               // most promising (highest color) first
+            const std::size_t v = n - 1 - j;
+            if (m_opt.cancel.expired()) inc.stop.store(true, std::memory_order_relaxed); // poll per branch too
+            if (inc.stop.load(std::memory_order_relaxed)) return;
+            if (bound[v] <= inc.size.load(std::memory_order_relaxed)) continue; // prefix cannot do better
+            s->branch(v);
+        }
+    }, m_opt.threads);
+
+    for (const Index v : inc.clique) res.clique.push_back(original[v]);
+    std::sort(res.clique.begin(), res.clique.end());
+    res.optimal = !inc.stop.load();
+    res.nodes = inc.nodes.load();
+    return res;
+}
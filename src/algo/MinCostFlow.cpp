@@ -0,0 +1,169 @@
+// ==========================
+// MinCostFlow.cpp
+// ==========================
+// Successive shortest paths declared in algo/MinCostFlow.hpp:
+// Bellman–Ford once for potentials, then Dijkstra on reduced costs with a
+// radix heap per augmentation.
+// ==========================
+
+#include "algo/MinCostFlow.hpp"  // class declaration
+#include <algorithm>             // std::min
+#include <array>                 // radix heap buckets
+#include <cstdint>               // std::uint64_t heap keys, std::uint32_t ids
+#include <deque>                 // Bellman–Ford work queue
+#include <stdexcept>             // std::out_of_range / std::invalid_argument
+#include <utility>               // std::pair
+
+namespace {
+using Index  = std::uint32_t;                                 // compact vertex / slot id
+using Weight = MinCostFlow::Weight;
+constexpr Weight kInf = std::numeric_limits<Weight>::max();
+constexpr Index  kNone = std::numeric_limits<Index>::max();
+
+// Monotone priority queue: keys popped never decrease, so a key only has to
+// be compared with the last popped one. Bucket b holds keys whose highest
+// bit differing from `last` is b-1; popping from an empty bucket 0 moves the
+// smallest non-empty bucket down, and each entry moves at most 64 times.
+class RadixHeap {
+public:
+    bool empty() const noexcept { return m_size == 0; }
+
+    void push(std::uint64_t key, Index v) { m_b[bucket(key)].emplace_back(key, v); ++m_size; }
+
+    std::pair<std::uint64_t, Index> pop() {
+        if (m_b[0].empty()) {                                 // refill bucket 0
+            std::size_t i = 1;
+            while (m_b[i].empty()) ++i;
+            std::uint64_t mn = m_b[i].front().first;
+            for (const auto& e : m_b[i]) mn = std::min(mn, e.first);
+            m_last = mn;
+            for (const auto& e : m_b[i]) m_b[bucket(e.first)].push_back(e); // lands below i
+            m_b[i].clear();
+        }
+        const auto e = m_b[0].back(); m_b[0].pop_back();
+        --m_size;
+        return e;
+    }
+
+    void reset() { for (auto& b : m_b) b.clear(); m_last = 0; m_size = 0; }
+
+private:
+    std::size_t bucket(std::uint64_t k) const noexcept {
+        return k == m_last ? 0 : 64 - static_cast<std::size_t>(__builtin_clzll(k ^ m_last));
+    }
+
+    std::array<std::vector<std::pair<std::uint64_t, Index>>, 65> m_b;
+    std::uint64_t m_last = 0;                                 // last popped key
+    std::size_t   m_size = 0;
+};
+
+// Residual network as parallel arrays; slots of vertex u are off[u]..off[u+1).
+struct Residual {
+    std::vector<std::size_t> off;
+    std::vector<Index>  to;
+    std::vector<Weight> cap, cost;
+    std::vector<std::size_t> rev;                             // slot of the opposite residual arc
+    std::vector<std::size_t> fwd;                             // forward slot of the k-th input arc
+    std::vector<Weight> cap0;                                 // input capacity of the k-th input arc
+};
+
+Residual build_residual(const Graph& g) {
+    Residual r;
+    const std::size_t n = g.n();
+    r.off.assign(n + 1, 0);
+    for (Graph::Vertex u = 0; u < n; ++u)                     // u gets a forward slot per out-arc
+        for (const auto& e : g.adj(u)) { ++r.off[u + 1]; ++r.off[e.first + 1]; } // and a backward per in-arc
+    for (std::size_t u = 0; u < n; ++u) r.off[u + 1] += r.off[u];
+
+    const std::size_t slots = r.off[n];
+    r.to.resize(slots); r.cap.resize(slots); r.cost.resize(slots); r.rev.resize(slots);
+    std::vector<std::size_t> pos(r.off.begin(), r.off.end() - 1);
+    for (Graph::Vertex u = 0; u < n; ++u) {
+        const auto& lst = g.adj(u);
+        for (std::size_t i = 0; i < lst.size(); ++i) {
+            const auto v = lst[i].first;
+            const Weight c = lst[i].second, w = g.cost(u, i);
+            if (c < 0) throw std::invalid_argument("negative capacity");
+            const std::size_t a = pos[u]++, b = pos[v]++;
+            r.to[a] = static_cast<Index>(v); r.cap[a] = c; r.cost[a] =  w; r.rev[a] = b;
+            r.to[b] = static_cast<Index>(u); r.cap[b] = 0; r.cost[b] = -w; r.rev[b] = a;
+            r.fwd.push_back(a); r.cap0.push_back(c);
+        }
+    }
+    return r;
+}
+} // namespace
+
+// --------------------------
+// compute
+// --------------------------
+MinCostFlow::Result MinCostFlow::compute(const Graph& g, Graph::Vertex s, Graph::Vertex t, Weight limit) const {
+    const std::size_t n = g.n();
+    if (s >= n || t >= n) throw std::out_of_range("vertex index out of range");
+    Result res;
+    if (s == t || limit <= 0) return res;
+
+    Residual r = build_residual(g);
+    std::vector<Weight> pot(n, 0);                            // Johnson potentials
+
+    bool negative = false;                                    // only pay for Bellman–Ford when needed
+    for (std::size_t a = 0; a < r.to.size() && !negative; ++a) negative = r.cap[a] > 0 && r.cost[a] < 0;
+    if (negative) {                                           // queue-based Bellman–Ford from s
+        std::vector<Weight> d(n, kInf);
+        std::vector<std::size_t> rounds(n, 0);
+        std::vector<char> queued(n, 0);
+        std::deque<Index> q;
+        d[s] = 0; q.push_back(static_cast<Index>(s)); queued[s] = 1;
+        while (!q.empty()) {
+            const Index u = q.front(); q.pop_front(); queued[u] = 0;
+            if (++rounds[u] > n) { res.negativeCycle = true; return res; } // relaxed > n times
+            for (std::size_t a = r.off[u]; a < r.off[u + 1]; ++a) {
+                if (r.cap[a] <= 0 || d[u] + r.cost[a] >= d[r.to[a]]) continue;
+                d[r.to[a]] = d[u] + r.cost[a];
+                if (!queued[r.to[a]]) { queued[r.to[a]] = 1; q.push_back(r.to[a]); }
+            }
+        }
+        for (std::size_t v = 0; v < n; ++v) pot[v] = d[v] == kInf ? 0 : d[v]; // unreachable: never visited
+    }
+
+    std::vector<Weight> dist(n);
+    std::vector<std::size_t> via(n);                          // residual slot used to reach v
+    RadixHeap heap;
+    while (res.flow < limit) {
+        std::fill(dist.begin(), dist.end(), kInf);
+        heap.reset();
+        dist[s] = 0; via[s] = kNone;
+        heap.push(0, static_cast<Index>(s));
+        while (!heap.empty()) {                               // Dijkstra on reduced costs (all >= 0)
+            const auto top = heap.pop();
+            const Index u = top.second;
+            if (static_cast<Weight>(top.first) != dist[u]) continue; // stale entry
+            for (std::size_t a = r.off[u]; a < r.off[u + 1]; ++a) {
+                if (r.cap[a] <= 0) continue;
+                const Index v = r.to[a];
+                const Weight nd = dist[u] + r.cost[a] + pot[u] - pot[v];
+                if (nd < dist[v]) { dist[v] = nd; via[v] = a; heap.push(static_cast<std::uint64_t>(nd), v); }
+            }
+        }
+        if (dist[t] == kInf) break;                           // no augmenting path left
+        for (std::size_t v = 0; v < n; ++v)                   // keep reduced costs non-negative
+            if (dist[v] != kInf) pot[v] += dist[v];
+
+        Weight push = limit - res.flow;                       // bottleneck along the path
+        for (std::size_t v = t; v != s; v = r.to[r.rev[via[v]]]) push = std::min(push, r.cap[via[v]]);
+        for (std::size_t v = t; v != s; v = r.to[r.rev[via[v]]]) {
+            const std::size_t a = via[v];
+            r.cap[a] -= push; r.cap[r.rev[a]] += push;
+            res.cost += push * r.cost[a];
+        }
+        res.flow += push;
+        ++res.augmentations;
+    }
+
+    for (std::size_t k = 0; k < r.fwd.size(); ++k) {          // report arcs that carry flow
+        const std::size_t a = r.fwd[k];
+        const Weight f = r.cap0[k] - r.cap[a];
+        if (f > 0) res.arcs.emplace_back(r.to[r.rev[a]], r.to[a], f);
+    }
+    return res;
+}
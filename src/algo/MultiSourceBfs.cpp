@@ -0,0 +1,129 @@
+// ==========================
+// MultiSourceBfs.cpp
+// ==========================
+// Bit-parallel MS-BFS declared in algo/MultiSourceBfs.hpp.
+// The batch kernel is instantiated per word count (1..8 words = 64..512
+// lanes) so the per-vertex bitset loops have a fixed trip count.
+// ==========================
+
+#include "algo/MultiSourceBfs.hpp" // class declaration
+#include "algo/Parallel.hpp"       // parallel_for over batches
+#include "graph/Csr.hpp"           // flat out-adjacency
+#include <algorithm>               // std::min, std::max, std::fill
+#include <stdexcept>               // std::out_of_range on bad sources
+
+namespace {
+using Index = Csr::Index;                                     // compact vertex id
+constexpr unsigned kMaxWords = 8;                             // 512 lanes
+
+// Scratch owned by one participant, reused across its batches.
+struct Scratch {
+    std::vector<std::uint64_t> seen, cur, next;               // n * W words each
+    std::vector<Index> active, upcoming;                      // vertices with a non-empty frontier / next
+    std::vector<char>  queued;                                // vertex already in `upcoming`
+};
+
+template <unsigned W>
+void run_batch(const Csr& adj, const Graph::Vertex* src, std::size_t lanes, Scratch& s,
+               std::size_t* ecc, std::size_t* reached, std::uint64_t* sum) {
+    const std::size_t n = adj.n();
+    if (s.seen.size() < n * W) {                              // first batch of this width
+        s.seen.resize(n * W); s.cur.resize(n * W); s.next.resize(n * W); s.queued.resize(n);
+    }
+    std::fill(s.seen.begin(), s.seen.begin() + n * W, 0);     // cur/next are left zeroed by the last batch
+    s.active.clear();
+
+    for (std::size_t i = 0; i < lanes; ++i) {                 // seed one lane per source
+        const std::size_t v = src[i];
+        const std::uint64_t bit = std::uint64_t(1) << (i % 64);
+        if (!s.queued[v]) { s.queued[v] = 1; s.active.push_back(static_cast<Index>(v)); } // a source may repeat
+        s.seen[v * W + i / 64] |= bit;
+        s.cur[v * W + i / 64]  |= bit;
+        ecc[i] = 0; reached[i] = 1; sum[i] = 0;
+    }
+    for (const Index v : s.active) s.queued[v] = 0;
+
+    for (std::size_t level = 1; !s.active.empty(); ++level) {
+        s.upcoming.clear();
+        for (const Index v : s.active) {                      // top-down: push v's lanes to its neighbors
+            const std::uint64_t* f = &s.cur[std::size_t(v) * W];
+            for (std::size_t p = adj.offsets[v]; p < adj.offsets[v + 1]; ++p) {
+                const std::size_t u = adj.targets[p];
+                const std::uint64_t* seen = &s.seen[u * W];
+                std::uint64_t* nx = &s.next[u * W];
+                std::uint64_t any = 0;
+                for (unsigned w = 0; w < W; ++w) {
+                    const std::uint64_t add = f[w] & ~seen[w];
+                    nx[w] |= add; any |= add;
+                }
+                if (any && !s.queued[u]) { s.queued[u] = 1; s.upcoming.push_back(static_cast<Index>(u)); }
+            }
+        }
+        for (const Index v : s.active)                        // old frontier is consumed
+            for (unsigned w = 0; w < W; ++w) s.cur[std::size_t(v) * W + w] = 0;
+
+        for (const Index u : s.upcoming) {                    // commit next → seen/frontier, credit lanes
+            s.queued[u] = 0;
+            for (unsigned w = 0; w < W; ++w) {
+                std::uint64_t bits = s.next[std::size_t(u) * W + w];
+                s.next[std::size_t(u) * W + w] = 0;
+                s.seen[std::size_t(u) * W + w] |= bits;
+                s.cur[std::size_t(u) * W + w] = bits;
+                while (bits) {
+                    const std::size_t lane = w * 64 + static_cast<std::size_t>(__builtin_ctzll(bits));
+                    ecc[lane] = level; ++reached[lane]; sum[lane] += level;
+                    bits &= bits - 1;
+                }
+            }
+        }
+        s.active.swap(s.upcoming);
+    }
+}
+
+using Kernel = void (*)(const Csr&, const Graph::Vertex*, std::size_t, Scratch&,
+                        std::size_t*, std::size_t*, std::uint64_t*);
+constexpr Kernel kKernels[kMaxWords] = {
+    run_batch<1>, run_batch<2>, run_batch<3>, run_batch<4>,
+    run_batch<5>, run_batch<6>, run_batch<7>, run_batch<8>,
+};
+} // namespace
+
+// --------------------------
+// compute
+// --------------------------
+MultiSourceBfs::Result MultiSourceBfs::compute(const Graph& g) const {
+    std::vector<Graph::Vertex> all(g.n());
+    for (std::size_t v = 0; v < all.size(); ++v) all[v] = v;
+    return compute(g, all);
+}
+
+MultiSourceBfs::Result MultiSourceBfs::compute(const Graph& g, const std::vector<Graph::Vertex>& sources) const {
+    for (auto v : sources)
+        if (v >= g.n()) throw std::out_of_range("vertex index out of range");
+
+    Result res;
+    const std::size_t k = sources.size();
+    res.eccentricity.assign(k, 0); res.reached.assign(k, 0); res.distanceSum.assign(k, 0);
+    if (k == 0) return res;
+
+    // Narrow the batches when there are too few sources to keep every
+    // participant busy; never exceed the requested width.
+    const unsigned slots = parallel_slots(m_opt.threads);
+    const std::size_t maxWords = std::min<std::size_t>(kMaxWords, std::max(1u, m_opt.width / 64));
+    const std::size_t wantWords = ((k + slots - 1) / slots + 63) / 64;
+    const std::size_t words = std::max<std::size_t>(1, std::min(maxWords, wantWords));
+    const std::size_t lanes = words * 64;
+    res.width = static_cast<unsigned>(lanes);
+    res.batches = (k + lanes - 1) / lanes;
+
+    const Csr& adj = Csr::of(g);
+    std::vector<Scratch> scratch(slots);
+    parallel_for(res.batches, 1, [&](std::size_t lo, std::size_t hi, unsigned slot){
+        for (std::size_t b = lo; b < hi; ++b) {
+            const std::size_t first = b * lanes, count = std::min(lanes, k - first);
+            kKernels[words - 1](adj, &sources[first], count, scratch[slot],
+                                &res.eccentricity[first], &res.reached[first], &res.distanceSum[first]);
+        }
+    }, m_opt.threads);
+    return res;
+}
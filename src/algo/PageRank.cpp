@@ -0,0 +1,215 @@
+// ==========================
+// PageRank.cpp
+// ==========================
+// Pull-based power iteration declared in algo/PageRank.hpp.
+// Layout: the transposed CSR is split into `blocks` source segments; block b
+// holds, for every destination v with at least one in-neighbor in
+// [b*B, (b+1)*B), those in-neighbors. Rows are compact (only destinations
+// present in the segment are listed), so the layout is O(n + m) whatever the
+// block count. Sweeping one block at a time keeps the random reads of the
+// contribution array inside a B-sized window (cache blocking). With a single
+// block this degenerates to the plain pull formulation.
+// ==========================
+
+#include "algo/PageRank.hpp"     // class declaration
+#include "algo/Parallel.hpp"     // parallel_for on the shared pool
+#include "graph/Csr.hpp"         // transposed CSR builder
+#include <algorithm>             // std::sort, std::stable_sort, std::min
+#include <chrono>                // per-iteration timing
+#include <cmath>                 // std::fabs
+#include <numeric>               // std::iota
+
+namespace {
+
+constexpr std::size_t kAutoBlockMinN = std::size_t(1) << 16; // auto-blocking only above this many vertices
+constexpr std::size_t kAutoBlockSize = std::size_t(1) << 15; // sources per block (~256 KB of doubles)
+constexpr std::size_t kGrain         = 2048;                  // vertices per parallel_for chunk
+
+// One source segment of the transposed graph.
+struct Block {
+    BigArray<Csr::Index>  rows;           // destination of each row (empty = all n, in order)
+    BigArray<std::size_t> offsets;        // rows+1 row starts
+    BigArray<Csr::Index>  sources;        // in-neighbors inside this segment
+};
+
+// Graph rearranged for iteration (possibly relabelled).
+struct Layout {
+    std::size_t n = 0;                    // vertex count
+    std::vector<Csr::Index> toNew;        // original id -> iteration id (empty = identity)
+    std::vector<std::size_t> outDeg;      // out-degree per iteration id
+    std::vector<Block> blocks;            // source segments
+};
+
+Layout build_layout(const Graph& g, const PageRank::Options& opt) {
+    Layout L;
+    L.n = g.n();
+    const std::size_t n = L.n;
+    Csr in = Csr::transposeOf(g);                            // in-neighbors, sources ascending
+
+    std::vector<std::size_t> outDeg(n);                      // out-degree in original ids
+    for (Graph::Vertex u = 0; u < n; ++u) outDeg[u] = g.adj(u).size();
+
+    if (opt.reorder && n > 1) {
+        // Frequency-based clustering: most-pulled vertices get the smallest ids.
+        std::vector<Csr::Index> byIn(n);
+        std::iota(byIn.begin(), byIn.end(), 0);
+        std::stable_sort(byIn.begin(), byIn.end(), [&](Csr::Index a, Csr::Index b){
+            return in.degree(a) > in.degree(b);
+        });
+        L.toNew.resize(n);
+        for (std::size_t i = 0; i < n; ++i) L.toNew[byIn[i]] = static_cast<Csr::Index>(i);
+
+        Csr re;                                              // transposed CSR in new ids
+        re.offsets.assign(n + 1, 0);
+        for (std::size_t i = 0; i < n; ++i) re.offsets[i + 1] = re.offsets[i] + in.degree(byIn[i]);
+        re.targets.resize(in.arcs());
+        for (std::size_t i = 0; i < n; ++i) {
+            auto* row = re.targets.data() + re.offsets[i];
+            std::size_t k = 0;
+            for (std::size_t p = in.offsets[byIn[i]]; p < in.offsets[byIn[i] + 1]; ++p)
+                row[k++] = L.toNew[in.targets[p]];
+            std::sort(row, row + k);                         // keep sources ascending for blocking
+        }
+        in = std::move(re);
+        L.outDeg.resize(n);
+        for (std::size_t u = 0; u < n; ++u) L.outDeg[L.toNew[u]] = outDeg[u];
+    } else {
+        L.outDeg = std::move(outDeg);
+    }
+
+    std::size_t B = opt.blockSize;                           // sources per block
+    if (B == 0) B = (n >= kAutoBlockMinN) ? kAutoBlockSize : n;
+    if (B == 0 || B >= n) {                                  // single block: reuse the CSR as is
+        L.blocks.push_back(Block{ {}, std::move(in.offsets), std::move(in.targets) });
+        return L;
+    }
+
+    const std::size_t nb = (n + B - 1) / B;                  // number of segments
+    std::vector<std::size_t> rowCount(nb), arcCount(nb);
+    for (std::size_t v = 0; v < n; ++v) {                    // count rows and arcs per block
+        std::size_t prev = nb;                               // sources ascend, so blocks do too
+        for (std::size_t p = in.offsets[v]; p < in.offsets[v + 1]; ++p) {
+            const std::size_t b = in.targets[p] / B;
+            if (b != prev) { ++rowCount[b]; prev = b; }
+            ++arcCount[b];
+        }
+    }
+    L.blocks.resize(nb);
+    for (std::size_t b = 0; b < nb; ++b) {
+        L.blocks[b].rows.resize(rowCount[b]);
+        L.blocks[b].offsets.resize(rowCount[b] + 1);
+        L.blocks[b].offsets[rowCount[b]] = arcCount[b];
+        L.blocks[b].sources.resize(arcCount[b]);
+        rowCount[b] = arcCount[b] = 0;                       // reused as fill cursors
+    }
+    for (std::size_t v = 0; v < n; ++v) {                    // scatter, rows stay sorted
+        std::size_t prev = nb;
+        for (std::size_t p = in.offsets[v]; p < in.offsets[v + 1]; ++p) {
+            const std::size_t b = in.targets[p] / B;
+            Block& blk = L.blocks[b];
+            if (b != prev) {                                 // v opens a row in block b
+                blk.rows[rowCount[b]] = static_cast<Csr::Index>(v);
+                blk.offsets[rowCount[b]++] = arcCount[b];
+                prev = b;
+            }
+            blk.sources[arcCount[b]++] = in.targets[p];
+        }
+    }
+    return L;
+}
+
+// Power iteration in the requested precision.
+template <typename Real>
+void iterate(const Layout& L, const PageRank::Options& opt, PageRank::Result& res) {
+    const std::size_t n = L.n;
+    const Real d    = static_cast<Real>(opt.damping);
+    const Real invN = Real(1) / static_cast<Real>(n);
+    const unsigned slots = parallel_slots(opt.threads);
+
+    std::vector<Real> rank(n, invN), next(n), contrib(n), invOut(n);
+    for (std::size_t u = 0; u < n; ++u)                      // 0 marks a dangling vertex
+        invOut[u] = L.outDeg[u] ? Real(1) / static_cast<Real>(L.outDeg[u]) : Real(0);
+
+    std::vector<double> partial(slots);                      // per-participant reductions
+    auto reduce = [&]{ double s = 0; for (double x : partial) s += x; std::fill(partial.begin(), partial.end(), 0.0); return s; };
+
+    for (std::size_t it = 0; it < opt.maxIterations; ++it) {
+        const auto t0 = std::chrono::steady_clock::now();
+
+        // 1) contributions + dangling mass
+        parallel_for(n, kGrain, [&](std::size_t lo, std::size_t hi, unsigned slot){
+            double dangling = 0;
+            for (std::size_t u = lo; u < hi; ++u) {
+                contrib[u] = rank[u] * invOut[u];
+                if (!L.outDeg[u]) dangling += rank[u];
+            }
+            partial[slot] += dangling;
+        }, opt.threads);
+        const Real base = (Real(1) - d) * invN + d * static_cast<Real>(reduce()) * invN;
+
+        // 2) gather, one source block at a time
+        const bool single = L.blocks.size() == 1;
+        if (single) {
+            const Block& blk = L.blocks[0];
+            parallel_for(n, kGrain, [&](std::size_t lo, std::size_t hi, unsigned){
+                for (std::size_t v = lo; v < hi; ++v) {
+                    Real acc = 0;
+                    for (std::size_t p = blk.offsets[v]; p < blk.offsets[v + 1]; ++p)
+                        acc += contrib[blk.sources[p]];
+                    next[v] = base + d * acc;                // fused finalize
+                }
+            }, opt.threads);
+        } else {
+            parallel_for(n, kGrain, [&](std::size_t lo, std::size_t hi, unsigned){
+                std::fill(next.begin() + lo, next.begin() + hi, Real(0));
+            }, opt.threads);
+            for (const Block& blk : L.blocks) {
+                parallel_for(blk.rows.size(), kGrain, [&](std::size_t lo, std::size_t hi, unsigned){
+                    for (std::size_t r = lo; r < hi; ++r) {  // each row is one destination
+                        Real acc = 0;
+                        for (std::size_t p = blk.offsets[r]; p < blk.offsets[r + 1]; ++p)
+                            acc += contrib[blk.sources[p]];
+                        next[blk.rows[r]] += acc;
+                    }
+                }, opt.threads);
+            }
+        }
+
+        // 3) finalize (blocked only) + L1 residual
+        parallel_for(n, kGrain, [&](std::size_t lo, std::size_t hi, unsigned slot){
+            double delta = 0;
+            for (std::size_t v = lo; v < hi; ++v) {
+                if (!single) next[v] = base + d * next[v];
+                delta += std::fabs(static_cast<double>(next[v]) - static_cast<double>(rank[v]));
+            }
+            partial[slot] += delta;
+        }, opt.threads);
+        res.residual = reduce();
+        rank.swap(next);
+
+        const auto t1 = std::chrono::steady_clock::now();
+        res.iterationMs.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+        res.iterations = it + 1;
+        if (res.residual < opt.tolerance) { res.converged = true; break; }
+    }
+
+    res.rank.resize(n);                                      // map back to original ids
+    for (std::size_t u = 0; u < n; ++u)
+        res.rank[u] = static_cast<double>(rank[L.toNew.empty() ? u : L.toNew[u]]);
+}
+
+} // namespace
+
+// --------------------------
+// compute
+// --------------------------
+PageRank::Result PageRank::compute(const Graph& g) const {
+    Result res;
+    if (g.n() == 0) { res.converged = true; return res; }   // nothing to rank
+
+    const Layout L = build_layout(g, m_opt);                 // CSR, relabel, blocking
+    res.blocks = L.blocks.size();
+    if (m_opt.singlePrecision) iterate<float>(L, m_opt, res);
+    else                       iterate<double>(L, m_opt, res);
+    return res;
+}
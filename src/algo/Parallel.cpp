@@ -0,0 +1,141 @@
+// ==========================
+// Parallel.cpp
+// ==========================
+// Implements the shared ThreadPool, the chunked parallel_for() helper and
+// the parallel_invoke() fork-join built on it, declared in algo/Parallel.hpp.
+// ==========================
+
+#include "algo/Parallel.hpp"     // ThreadPool, parallel_for
+#include "sys/Topology.hpp"      // CpuPlacement for pin()
+#include <algorithm>             // std::min, std::max
+#include <memory>                // std::shared_ptr for loop state shared with helpers
+
+// --------------------------
+// ThreadPool
+// --------------------------
+ThreadPool::ThreadPool(unsigned threads) {
+    if (threads == 0) threads = 1;                          // always at least one worker
+    m_workers.reserve(threads);                             // avoid reallocation while spawning
+    for (unsigned i = 0; i < threads; ++i)                  // spawn the workers
+        m_workers.emplace_back([this]{ workerLoop(); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lk(m_mu);               // publish the stop request
+        m_stop = true;
+    }
+    m_cv.notify_all();                                      // wake every parked worker
+    for (auto& t : m_workers) if (t.joinable()) t.join();   // wait for them to drain and exit
+}
+
+ThreadPool& ThreadPool::shared() {
+    // Leave one hardware thread for the caller, which always participates.
+    static ThreadPool pool(std::max(2u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lk(m_mu);               // guard the queue
+        m_tasks.push_back(std::move(task));                 // append task
+    }
+    m_cv.notify_one();                                      // wake one worker
+}
+
+unsigned ThreadPool::pin(const CpuPlacement& placement) {
+    unsigned ok = 0;                                        // workers placed
+    for (std::size_t i = 0; i < m_workers.size(); ++i)      // worker i is slot i + 1
+        ok += placement.pin(m_workers[i], (unsigned)i + 1) ? 1 : 0;
+    return ok;
+}
+
+void ThreadPool::workerLoop() {
+    for (;;) {
+        std::function<void()> task;                         // next task to run
+        {
+            std::unique_lock<std::mutex> lk(m_mu);
+            m_idle.fetch_add(1, std::memory_order_relaxed); // parked
+            m_cv.wait(lk, [this]{ return m_stop || !m_tasks.empty(); });
+            m_idle.fetch_sub(1, std::memory_order_relaxed); // running again
+            if (m_tasks.empty()) return;                    // stop requested and queue drained
+            task = std::move(m_tasks.front());              // take oldest task
+            m_tasks.pop_front();
+        }
+        task();                                             // run outside the lock
+    }
+}
+
+// --------------------------
+// parallel_for
+// --------------------------
+unsigned parallel_slots(unsigned maxThreads) {
+    const unsigned all = ThreadPool::shared().size() + 1;   // pool workers + caller
+    return maxThreads == 0 ? all : std::min(all, maxThreads);
+}
+
+namespace {
+// State shared between the caller and its helper tasks. Helpers that start
+// after every chunk was claimed return without touching `body`, so the
+// caller may return (and destroy body) as soon as all chunks are done.
+struct LoopState {
+    std::size_t n = 0, grain = 1, chunks = 0;               // iteration space
+    const std::function<void(std::size_t, std::size_t, unsigned)>* body = nullptr;
+    std::atomic<std::size_t> next{0};                       // next unclaimed chunk
+    std::atomic<unsigned> slots{0};                         // next participant slot
+    std::size_t done = 0;                                   // finished chunks (under mu)
+    std::mutex mu;                                          // guards done
+    std::condition_variable cv;                             // signals the caller
+};
+
+void run_chunks(LoopState& st) {
+    std::size_t c = st.next.fetch_add(1);                   // claim first chunk
+    if (c >= st.chunks) return;                             // nothing left: never touch body
+    const unsigned slot = st.slots.fetch_add(1);            // dense participant index
+    std::size_t finished = 0;                               // chunks completed by us
+    for (; c < st.chunks; c = st.next.fetch_add(1)) {
+        const std::size_t lo = c * st.grain;                // chunk bounds
+        const std::size_t hi = std::min(st.n, lo + st.grain);
+        (*st.body)(lo, hi, slot);                           // run the user body
+        ++finished;
+    }
+    std::lock_guard<std::mutex> lk(st.mu);                  // report completions
+    st.done += finished;
+    if (st.done == st.chunks) st.cv.notify_all();           // last chunk → wake the caller
+}
+} // namespace
+
+void parallel_for(std::size_t n, std::size_t grain,
+                  const std::function<void(std::size_t, std::size_t, unsigned)>& body,
+                  unsigned maxThreads) {
+    if (n == 0) return;                                     // empty range
+    if (grain == 0) grain = 1;                              // guard division
+    const std::size_t chunks = (n + grain - 1) / grain;     // number of chunks
+    const unsigned slots = parallel_slots(maxThreads);      // participants allowed
+    if (chunks == 1 || slots == 1) {                        // not worth a handoff
+        body(0, n, 0);
+        return;
+    }
+
+    auto st = std::make_shared<LoopState>();                // shared with helper tasks
+    st->n = n; st->grain = grain; st->chunks = chunks; st->body = &body;
+
+    const std::size_t helpers = std::min<std::size_t>(slots - 1, chunks - 1);
+    auto& pool = ThreadPool::shared();
+    for (std::size_t i = 0; i < helpers; ++i)               // enlist helpers
+        pool.submit([st]{ run_chunks(*st); });
+
+    run_chunks(*st);                                        // caller works too
+
+    std::unique_lock<std::mutex> lk(st->mu);                // wait for chunks claimed by helpers
+    st->cv.wait(lk, [&]{ return st->done == st->chunks; });
+}
+
+// --------------------------
+// parallel_invoke
+// --------------------------
+void parallel_invoke(const std::vector<std::function<void()>>& tasks, unsigned maxThreads) {
+    parallel_for(tasks.size(), 1, [&](std::size_t lo, std::size_t hi, unsigned) {
+        for (std::size_t i = lo; i < hi; ++i) tasks[i]();  // one task per chunk
+    }, maxThreads);
+}
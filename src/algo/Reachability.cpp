@@ -0,0 +1,215 @@
+// ==========================
+// Reachability.cpp
+// ==========================
+// Condensation + closure / interval index declared in algo/Reachability.hpp.
+// ==========================
+
+#include "algo/Reachability.hpp" // class declaration
+#include "algo/Parallel.hpp"     // parallel_for for level-wise closure and batches
+#include "algo/Scc.hpp"          // condensation with topological ids
+#include <algorithm>             // std::max, std::min
+#include <limits>                // label sentinels
+#include <random>                // std::mt19937 for GRAIL labelings
+#include <stdexcept>             // std::out_of_range on bad queries
+
+namespace {
+constexpr std::size_t kBatchGrain = 1024;                     // queries per parallel chunk
+
+struct Frame {
+    std::size_t c;                                            // component being expanded
+    std::size_t j;                                            // successors tried so far
+    std::size_t rot;                                          // random rotation of the successor list
+};
+} // namespace
+
+// --------------------------
+// construction
+// --------------------------
+ReachabilityIndex::ReachabilityIndex(const Graph& g) : ReachabilityIndex(g, Options{}) {}
+
+ReachabilityIndex::ReachabilityIndex(const Graph& g, const Options& opt) : m_opt(opt) {
+    StrongComponents::Options so; so.condensation = true;     // need the DAG, not just labels
+    auto scc = StrongComponents(so).compute(g);
+    m_comp    = std::move(scc.component);
+    m_succOff = std::move(scc.dagOffsets);
+    m_succ    = std::move(scc.dagTargets);
+    if (m_succOff.empty()) m_succOff.assign(1, 0);            // empty graph: zero components
+
+    m_mode = opt.mode;
+    if (m_mode == Mode::Auto)
+        m_mode = components() <= opt.closureLimit ? Mode::Closure : Mode::Interval;
+    if (m_mode == Mode::Closure) buildClosure();
+    else                         buildIntervals();
+}
+
+// Closure: row c = {c} ∪ rows of its successors. Rows are filled by height
+// (longest path to a sink) so every successor row is final before it is read,
+// and all rows of one height are independent → one parallel_for per level.
+void ReachabilityIndex::buildClosure() {
+    const std::size_t k = components();
+    m_words = (k + 63) / 64;
+    m_bits.assign(k * m_words, 0);
+
+    std::vector<std::size_t> height(k, 0);                    // successors have larger ids
+    std::size_t maxH = 0;
+    for (std::size_t c = k; c-- > 0; ) {
+        for (std::size_t p = m_succOff[c]; p < m_succOff[c + 1]; ++p)
+            height[c] = std::max(height[c], height[m_succ[p]] + 1);
+        maxH = std::max(maxH, height[c]);
+    }
+    std::vector<std::vector<std::size_t>> level(k ? maxH + 1 : 0);
+    for (std::size_t c = 0; c < k; ++c) level[height[c]].push_back(c);
+
+    for (const auto& rows : level) {
+        parallel_for(rows.size(), 64, [&](std::size_t lo, std::size_t hi, unsigned){
+            for (std::size_t i = lo; i < hi; ++i) {
+                const std::size_t c = rows[i];
+                std::uint64_t* row = &m_bits[c * m_words];
+                row[c / 64] |= std::uint64_t(1) << (c % 64);
+                for (std::size_t p = m_succOff[c]; p < m_succOff[c + 1]; ++p) {
+                    const std::size_t d = m_succ[p];
+                    const std::uint64_t* src = &m_bits[d * m_words];
+                    for (std::size_t w = d / 64; w < m_words; ++w) // bits below d are always 0 in row d
+                        row[w] |= src[w];
+                }
+            }
+        }, m_opt.threads);
+    }
+}
+
+// Interval labels: for each labeling, a DFS over the DAG with a random
+// root order and randomly rotated successor lists assigns post-order ranks;
+// low = min rank in the subtree incl. already-finished descendants, so
+// u ->* v implies [low_v, post_v] ⊆ [low_u, post_u] in every labeling.
+void ReachabilityIndex::buildIntervals() {
+    const std::size_t k = components();
+    const unsigned L = std::max(1u, m_opt.labels);
+    m_opt.labels = L;
+    m_low.assign(k * L, 0); m_post.assign(k * L, 0);
+    m_pre.assign(k, 0);     m_end.assign(k, 0);
+
+    std::mt19937 rng(m_opt.seed);
+    std::vector<std::size_t> roots(k);
+    for (std::size_t c = 0; c < k; ++c) roots[c] = c;
+    std::vector<char> seen(k);
+    std::vector<Frame> st;
+
+    for (unsigned l = 0; l < L; ++l) {
+        std::shuffle(roots.begin(), roots.end(), rng);
+        std::fill(seen.begin(), seen.end(), 0);
+        std::uint32_t post = 0, pre = 0;
+        auto rot = [&](std::size_t c) {
+            const std::size_t deg = m_succOff[c + 1] - m_succOff[c];
+            return deg ? rng() % deg : 0;
+        };
+        for (std::size_t r : roots) {
+            if (seen[r]) continue;
+            seen[r] = 1;
+            if (l == 0) m_pre[r] = pre++;
+            m_low[r * L + l] = std::numeric_limits<std::uint32_t>::max();
+            st.push_back({ r, 0, rot(r) });
+            while (!st.empty()) {
+                Frame& f = st.back();
+                const std::size_t c = f.c;
+                const std::size_t deg = m_succOff[c + 1] - m_succOff[c];
+                if (f.j < deg) {
+                    const std::size_t d = m_succ[m_succOff[c] + (f.rot + f.j++) % deg];
+                    if (!seen[d]) {                                  // tree arc: descend
+                        seen[d] = 1;
+                        if (l == 0) m_pre[d] = pre++;
+                        m_low[d * L + l] = std::numeric_limits<std::uint32_t>::max();
+                        st.push_back({ d, 0, rot(d) });              // invalidates f
+                    } else {                                         // finished descendant
+                        m_low[c * L + l] = std::min(m_low[c * L + l], m_low[d * L + l]);
+                    }
+                    continue;
+                }
+                m_post[c * L + l] = post;                            // c finished
+                m_low[c * L + l] = std::min(m_low[c * L + l], post++);
+                if (l == 0) m_end[c] = pre;
+                st.pop_back();
+                if (!st.empty()) {                                   // fold into parent
+                    const std::size_t p = st.back().c;
+                    m_low[p * L + l] = std::min(m_low[p * L + l], m_low[c * L + l]);
+                }
+            }
+        }
+    }
+}
+
+// --------------------------
+// queries
+// --------------------------
+bool ReachabilityIndex::searchIntervals(std::size_t cu, std::size_t cv, std::vector<std::uint32_t>& stamp,
+                                        std::uint32_t mark, std::vector<std::size_t>& stack) const {
+    const unsigned L = m_opt.labels;
+    auto may_reach = [&](std::size_t a) {                     // labels do not rule out a ->* cv
+        for (unsigned l = 0; l < L; ++l)
+            if (m_low[a * L + l] > m_low[cv * L + l] || m_post[cv * L + l] > m_post[a * L + l]) return false;
+        return true;
+    };
+    auto tree_reach = [&](std::size_t a) { return m_pre[a] <= m_pre[cv] && m_pre[cv] < m_end[a]; };
+
+    if (!may_reach(cu)) return false;                         // negative cut
+    if (tree_reach(cu)) return true;                          // positive cut
+
+    stack.clear();
+    stack.push_back(cu);
+    stamp[cu] = mark;
+    while (!stack.empty()) {                                  // label-pruned DFS
+        const std::size_t a = stack.back(); stack.pop_back();
+        for (std::size_t p = m_succOff[a]; p < m_succOff[a + 1]; ++p) {
+            const std::size_t b = m_succ[p];
+            if (b == cv) return true;
+            if (b > cv || stamp[b] == mark || !may_reach(b)) continue; // topological / visited / label prune
+            if (tree_reach(b)) return true;
+            stamp[b] = mark;
+            stack.push_back(b);
+        }
+    }
+    return false;
+}
+
+bool ReachabilityIndex::reachable(Graph::Vertex u, Graph::Vertex v) const {
+    if (u >= m_comp.size() || v >= m_comp.size())
+        throw std::out_of_range("vertex index out of range");
+    const std::size_t cu = m_comp[u], cv = m_comp[v];
+    if (cu == cv) return true;                                // same SCC
+    if (cu > cv)  return false;                               // ids are topological
+    if (m_mode == Mode::Closure)
+        return (m_bits[cu * m_words + cv / 64] >> (cv % 64)) & 1u;
+    std::vector<std::uint32_t> stamp(components(), 0);
+    std::vector<std::size_t> stack;
+    return searchIntervals(cu, cv, stamp, 1, stack);
+}
+
+std::vector<char> ReachabilityIndex::query(const std::vector<std::pair<Graph::Vertex, Graph::Vertex>>& q) const {
+    for (const auto& uv : q)                                  // validate before going parallel
+        if (uv.first >= m_comp.size() || uv.second >= m_comp.size())
+            throw std::out_of_range("vertex index out of range");
+
+    std::vector<char> out(q.size(), 0);
+    const unsigned slots = parallel_slots(m_opt.threads);
+    std::vector<std::vector<std::uint32_t>> stamps(m_mode == Mode::Interval ? slots : 0);
+    std::vector<std::uint32_t> marks(slots, 0);
+
+    parallel_for(q.size(), kBatchGrain, [&](std::size_t lo, std::size_t hi, unsigned slot){
+        std::vector<std::size_t> stack;
+        for (std::size_t i = lo; i < hi; ++i) {
+            const std::size_t cu = m_comp[q[i].first], cv = m_comp[q[i].second];
+            if (cu == cv)                 { out[i] = 1; continue; }
+            if (cu > cv)                  { out[i] = 0; continue; }
+            if (m_mode == Mode::Closure)  { out[i] = (m_bits[cu * m_words + cv / 64] >> (cv % 64)) & 1u; continue; }
+            auto& stamp = stamps[slot];                       // per-participant visited marks
+            if (stamp.empty()) stamp.assign(components(), 0);
+            if (++marks[slot] == 0) { std::fill(stamp.begin(), stamp.end(), 0); marks[slot] = 1; }
+            out[i] = searchIntervals(cu, cv, stamp, marks[slot], stack);
+        }
+    }, m_opt.threads);
+    return out;
+}
+
+std::size_t ReachabilityIndex::bytes() const noexcept {
+    return m_bits.size() * sizeof(std::uint64_t)
+         + (m_low.size() + m_post.size() + m_pre.size() + m_end.size()) * sizeof(std::uint32_t);
+}
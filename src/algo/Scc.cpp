@@ -0,0 +1,113 @@
+// ==========================
+// Scc.cpp
+// ==========================
+// Iterative Tarjan SCC + condensation declared in algo/Scc.hpp.
+// Frames keep (vertex, next adjacency slot) so deep graphs never recurse.
+// ==========================
+
+#include "algo/Scc.hpp"          // class declaration
+#include "graph/Csr.hpp"         // flat out-adjacency
+#include <algorithm>             // std::min, std::sort
+#include <limits>                // "unvisited" marker
+
+namespace {
+constexpr std::size_t kUnseen = std::numeric_limits<std::size_t>::max();
+
+struct Frame {
+    Csr::Index  u;                                            // vertex being expanded
+    std::size_t next;                                         // next adjacency slot of u
+};
+} // namespace
+
+// --------------------------
+// compute
+// --------------------------
+StrongComponents::Result StrongComponents::compute(const Graph& g) const {
+    Result res;
+    const Csr& adj = Csr::of(g);                              // out-arcs (both directions if undirected)
+    const std::size_t n = adj.n();
+
+    std::vector<std::size_t> index(n, kUnseen), low(n, 0);    // Tarjan discovery index / low-link
+    std::vector<char> onStack(n, 0);                          // membership in the SCC stack
+    std::vector<Csr::Index> scc;                              // Tarjan's vertex stack
+    std::vector<Frame> st;                                    // explicit DFS stack
+    res.component.assign(n, 0);
+    std::size_t timer = 0;
+
+    for (std::size_t root = 0; root < n; ++root) {
+        if (index[root] != kUnseen) continue;                 // already assigned
+        index[root] = low[root] = timer++;
+        scc.push_back(static_cast<Csr::Index>(root)); onStack[root] = 1;
+        st.push_back({ static_cast<Csr::Index>(root), adj.offsets[root] });
+
+        while (!st.empty()) {
+            Frame& f = st.back();
+            const Csr::Index u = f.u;
+            if (f.next < adj.offsets[u + 1]) {                // try next arc u->v
+                const Csr::Index v = adj.targets[f.next++];
+                if (index[v] == kUnseen) {                    // tree arc: descend
+                    index[v] = low[v] = timer++;
+                    scc.push_back(v); onStack[v] = 1;
+                    st.push_back({ v, adj.offsets[v] });      // invalidates f
+                } else if (onStack[v]) {                      // arc into the open component
+                    low[u] = std::min(low[u], index[v]);
+                }
+                continue;
+            }
+
+            st.pop_back();                                    // u finished
+            if (!st.empty()) {                                // propagate to parent
+                const Csr::Index p = st.back().u;
+                low[p] = std::min(low[p], low[u]);
+            }
+            if (low[u] == index[u]) {                         // u roots an SCC: pop it
+                for (;;) {
+                    const Csr::Index w = scc.back(); scc.pop_back();
+                    onStack[w] = 0;
+                    res.component[w] = res.count;             // reverse-topological id for now
+                    if (w == u) break;
+                }
+                ++res.count;
+            }
+        }
+    }
+
+    for (auto& c : res.component) c = res.count - 1 - c;      // flip: ids become a topological order
+    if (!m_opt.condensation) return res;
+
+    const std::size_t k = res.count;
+    res.topoOrder.resize(k);
+    for (std::size_t c = 0; c < k; ++c) res.topoOrder[c] = c;
+
+    // Bucket vertices by component (counting sort), then gather distinct successors.
+    std::vector<std::size_t> start(k + 1, 0), members(n);
+    for (std::size_t v = 0; v < n; ++v) ++start[res.component[v] + 1];
+    for (std::size_t c = 0; c < k; ++c) start[c + 1] += start[c];
+    {
+        std::vector<std::size_t> fill(start.begin(), start.end() - 1);
+        for (std::size_t v = 0; v < n; ++v) members[fill[res.component[v]]++] = v;
+    }
+
+    std::vector<std::size_t> stamp(k, kUnseen);               // last row that recorded each target
+    res.dagOffsets.assign(k + 1, 0);
+    for (std::size_t c = 0; c < k; ++c) {
+        const std::size_t rowBegin = res.dagTargets.size();
+        for (std::size_t i = start[c]; i < start[c + 1]; ++i) {
+            const std::size_t u = members[i];
+            for (std::size_t p = adj.offsets[u]; p < adj.offsets[u + 1]; ++p) {
+                const std::size_t d = res.component[adj.targets[p]];
+                if (d != c && stamp[d] != c) { stamp[d] = c; res.dagTargets.push_back(d); }
+            }
+        }
+        std::sort(res.dagTargets.begin() + rowBegin, res.dagTargets.end());
+        res.dagOffsets[c + 1] = res.dagTargets.size();
+    }
+    return res;
+}
+
+// --------------------------
+// of
+// --------------------------
+const StrongComponents::Result& StrongComponents::of(const Graph& g) {
+    return g.cache().get<Result>(GraphCache::Slot::Components, [&]{ return StrongComponents().compute(g); });
+}
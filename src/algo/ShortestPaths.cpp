@@ -0,0 +1,55 @@
+// ==========================
+// ShortestPaths.cpp
+// ==========================
+// Min-plus Bellman–Ford declared in algo/ShortestPaths.hpp, written as a
+// loop of sparse / dense vector-matrix products (algo/SparseLinear.hpp).
+// ==========================
+
+#include "algo/ShortestPaths.hpp" // class declaration
+#include <stdexcept>              // std::out_of_range on a bad source
+
+using MinPlus = semiring::MinPlus<ShortestPaths::Distance>;
+
+ShortestPaths::Result ShortestPaths::compute(const Graph& g, Graph::Vertex source) const {
+    const std::size_t n = g.n();
+    if (source >= n) throw std::out_of_range("SSSP source out of range");
+    const FrontierGraph A = FrontierGraph::of(g);
+    const std::size_t denseWork = A.out.arcs() / (m_opt.denseDivisor ? m_opt.denseDivisor : 1);
+
+    Result r;
+    r.dist.assign(n, kUnreached);
+    r.dist[source] = 0;
+    SparseVector<Distance> x;                                   // distances that dropped last round
+    x.n = n;
+    x.ids.push_back(static_cast<Csr::Index>(source));
+    x.values.push_back(0);
+    std::vector<Distance> dense, y;
+    SpmspvWorkspace<Distance> ws;                               // O(n) once, not per sparse round
+
+    // A simple path has at most n-1 arcs: a drop in round n means a negative cycle.
+    for (std::size_t round = 0; round < n && x.nnz(); ++round, ++r.rounds) {
+        std::size_t work = x.nnz();
+        for (Csr::Index u : x.ids) work += A.out.degree(u);
+
+        SparseVector<Distance> next;
+        next.n = n;
+        if (work > denseWork) {
+            dense.assign(n, MinPlus::zero());
+            for (std::size_t k = 0; k < x.nnz(); ++k) dense[x.ids[k]] = x.values[k];
+            spmv<MinPlus>(A, dense, y, Mask{}, m_opt.threads);
+            for (std::size_t v = 0; v < n; ++v)
+                if (y[v] < r.dist[v]) { next.ids.push_back(static_cast<Csr::Index>(v)); next.values.push_back(y[v]); }
+            ++r.denseRounds;
+        } else {
+            const auto t = spmspv<MinPlus>(A, x, ws, Mask{}, m_opt.threads);
+            for (std::size_t k = 0; k < t.nnz(); ++k)
+                if (t.values[k] < r.dist[t.ids[k]]) { next.ids.push_back(t.ids[k]); next.values.push_back(t.values[k]); }
+        }
+        for (std::size_t k = 0; k < next.nnz(); ++k) r.dist[next.ids[k]] = next.values[k];
+        x = std::move(next);
+    }
+    r.negativeCycle = x.nnz() > 0;
+
+    for (Distance d : r.dist) if (d != kUnreached) ++r.reached;
+    return r;
+}
@@ -0,0 +1,294 @@
+// ==========================
+// SmallGraphBatch.cpp
+// ==========================
+// Arena + 64-bit mask kernels declared in algo/SmallGraphBatch.hpp.
+// Every kernel reproduces the reply of the matching strategy in
+// AlgorithmFactory.cpp (same checks, same vertex order, same text).
+// ==========================
+
+#include "algo/SmallGraphBatch.hpp"   // class declaration
+#include "algo/Parallel.hpp"          // parallel_for, parallel_slots
+#include <algorithm>                  // std::sort, std::min
+#include <array>                      // fixed-size per-participant scratch
+#include <climits>                    // LLONG_MAX bottleneck start
+#include <memory>                     // per-participant scratch
+#include <stdexcept>                  // std::invalid_argument
+
+namespace {
+using Mask = SmallGraphBatch::Mask;
+using Arc  = SmallGraphBatch::Arc;
+constexpr std::size_t N = SmallGraphBatch::kMaxVertices;
+constexpr std::size_t kGrain = 64;                            // graphs per parallel chunk
+
+// One graph of the arena, as the kernels see it.
+struct View {
+    std::size_t n;
+    bool        directed;
+    const Mask* rows;                                         // n out-neighbor masks
+    const Arc*  arcs;                                         // weighted arcs
+    std::size_t arcCount;
+};
+
+// Scratch reused by one participant for all of its graphs.
+struct Scratch {
+    std::array<long long, N * N> cap;                         // residual capacities (max flow)
+    std::array<Mask, N> aux;                                  // transposed / symmetric / residual rows
+    std::array<Arc, N * (N - 1)> edges;                       // sortable copy of the arcs (MST)
+    std::array<std::uint8_t, N + 1> path;                     // Hamiltonian path / BFS parents
+};
+
+Mask full_mask(std::size_t n) { return n == N ? ~Mask(0) : (Mask(1) << n) - 1; }
+unsigned first_bit(Mask m) { return static_cast<unsigned>(__builtin_ctzll(m)); }
+
+// Vertices reachable from `start` inside `allowed` (start must be allowed).
+Mask reach(const Mask* rows, std::size_t start, Mask allowed) {
+    Mask seen = Mask(1) << start, frontier = seen;
+    while (frontier) {
+        Mask next = 0;
+        for (Mask f = frontier; f; f &= f - 1) next |= rows[first_bit(f)];
+        frontier = next & allowed & ~seen;
+        seen |= frontier;
+    }
+    return seen;
+}
+
+// out[v] gets bit u for every arc u->v.
+void transpose(const View& g, Mask* out) {
+    for (std::size_t v = 0; v < g.n; ++v) out[v] = 0;
+    for (std::size_t u = 0; u < g.n; ++u)
+        for (Mask r = g.rows[u]; r; r &= r - 1) out[first_bit(r)] |= Mask(1) << u;
+}
+
+// Append the decimal digits of x.
+void append_num(std::string& s, long long x) { s += std::to_string(x); }
+
+// --------------------------
+// kernels
+// --------------------------
+std::string mst(const View& g, Scratch& s) {
+    if (g.directed) return "MST undefined for directed graphs.";
+    if (reach(g.rows, 0, full_mask(g.n)) != full_mask(g.n))
+        return "Graph is disconnected; MST does not exist.";
+
+    Arc* e = s.edges.data();                                  // Kruskal over the (few) edges
+    std::copy(g.arcs, g.arcs + g.arcCount, e);
+    std::sort(e, e + g.arcCount, [](const Arc& a, const Arc& b){
+        return static_cast<int>(a.w) < static_cast<int>(b.w); // the strategy sorts int weights
+    });
+    std::array<std::uint8_t, N> parent;
+    for (std::size_t v = 0; v < g.n; ++v) parent[v] = static_cast<std::uint8_t>(v);
+    auto find = [&](std::uint8_t x) {
+        while (parent[x] != x) x = parent[x] = parent[parent[x]];   // path halving
+        return x;
+    };
+    long long total = 0;
+    std::size_t used = 0;
+    for (std::size_t i = 0; i < g.arcCount && used + 1 < g.n; ++i) {
+        const std::uint8_t a = find(e[i].u), b = find(e[i].v);
+        if (a == b) continue;
+        parent[b] = a;
+        total += static_cast<int>(e[i].w);
+        ++used;
+    }
+    std::string out = "MST weight: ";
+    append_num(out, total);
+    out += " (edges used: ";
+    append_num(out, static_cast<long long>(used));
+    out += ").";
+    return out;
+}
+
+std::string scc(const View& g, Scratch& s) {
+    const Mask* back = g.rows;                                // undirected: rows are symmetric
+    if (g.directed) { transpose(g, s.aux.data()); back = s.aux.data(); }
+    const Mask all = full_mask(g.n);
+    long long count = 0;
+    for (Mask left = all; left; ++count) {                    // peel one component per round
+        const unsigned v = first_bit(left);
+        left &= ~(reach(g.rows, v, all) & reach(back, v, all));
+    }
+    std::string out = "SCC count: ";
+    append_num(out, count);
+    out += ".";
+    return out;
+}
+
+std::string maxflow(const View& g, Scratch& s) {
+    const std::size_t n = g.n;
+    if (n < 2) return "Max flow: 0 (need at least two vertices).";
+
+    long long* cap = s.cap.data();                            // n×n residual capacities
+    Mask* open = s.aux.data();                                // bit v of open[u] iff cap[u][v] > 0
+    std::fill(cap, cap + n * n, 0);
+    for (std::size_t i = 0; i < g.arcCount; ++i) {
+        const Arc& a = g.arcs[i];
+        const long long c = a.w ? static_cast<long long>(a.w) : 1LL;   // unweighted arcs carry 1
+        cap[a.u * n + a.v] += c;
+        if (!g.directed) cap[a.v * n + a.u] += c;
+    }
+    for (std::size_t u = 0; u < n; ++u) {
+        open[u] = 0;
+        for (Mask r = g.rows[u]; r; r &= r - 1)
+            if (cap[u * n + first_bit(r)] > 0) open[u] |= Mask(1) << first_bit(r);
+    }
+
+    const std::size_t src = 0, t = n - 1;
+    std::uint8_t* parent = s.path.data();
+    long long flow = 0;
+    for (;;) {
+        Mask seen = Mask(1) << src, frontier = seen;          // level-synchronous BFS on masks
+        while (frontier && !((seen >> t) & 1)) {
+            Mask next = 0;
+            for (Mask f = frontier; f; f &= f - 1) {
+                const unsigned u = first_bit(f);
+                const Mask fresh = open[u] & ~seen & ~next;
+                for (Mask r = fresh; r; r &= r - 1) parent[first_bit(r)] = static_cast<std::uint8_t>(u);
+                next |= fresh;
+            }
+            seen |= next;
+            frontier = next;
+        }
+        if (!((seen >> t) & 1)) break;                        // no augmenting path
+
+        long long add = LLONG_MAX;
+        for (std::size_t v = t; v != src; v = parent[v]) add = std::min(add, cap[parent[v] * n + v]);
+        for (std::size_t v = t; v != src; v = parent[v]) {
+            const std::size_t u = parent[v];
+            if ((cap[u * n + v] -= add) <= 0) open[u] &= ~(Mask(1) << v);
+            if ((cap[v * n + u] += add) > 0)  open[v] |=  (Mask(1) << u);
+        }
+        flow += add;
+    }
+    std::string out = "Max flow (0 -> ";
+    append_num(out, static_cast<long long>(t));
+    out += "): ";
+    append_num(out, flow);
+    out += ".";
+    return out;
+}
+
+std::string hamilton(const View& g, Scratch& s) {
+    const std::size_t n = g.n;
+    if (n == 1) return "Hamiltonian circuit: 0 -> 0";
+    const Mask all = full_mask(n);
+
+    if (n >= 3) {                                             // connected and cut-free, ignoring direction
+        Mask* sym = s.aux.data();
+        transpose(g, sym);
+        for (std::size_t v = 0; v < n; ++v) sym[v] |= g.rows[v];
+        if (reach(sym, 0, all) != all) return "No Hamiltonian circuit (graph is disconnected).";
+        for (std::size_t v = 0; v < n; ++v) {                 // smallest cut vertex, like Biconnectivity
+            const Mask rest = all & ~(Mask(1) << v);
+            if (reach(sym, v == 0 ? 1 : 0, rest) != rest) {
+                std::string out = "No Hamiltonian circuit (vertex ";
+                append_num(out, static_cast<long long>(v));
+                out += " is an articulation point).";
+                return out;
+            }
+        }
+    }
+
+    std::uint8_t* path = s.path.data();                       // ascending candidate order, as the strategy
+    path[0] = 0;
+    auto dfs = [&](auto&& self, std::size_t depth, Mask used) -> bool {
+        const std::size_t u = path[depth - 1];
+        if (depth == n) {                                     // all placed: need an arc back to 0
+            if (!(g.rows[u] & 1)) return false;
+            path[n] = 0;
+            return true;
+        }
+        for (Mask cand = g.rows[u] & ~used; cand; cand &= cand - 1) {
+            const unsigned v = first_bit(cand);
+            path[depth] = static_cast<std::uint8_t>(v);
+            if (self(self, depth + 1, used | (Mask(1) << v))) return true;
+        }
+        return false;
+    };
+    if (!dfs(dfs, 1, 1)) return "No Hamiltonian circuit.";
+
+    std::string out = "Hamiltonian circuit: ";
+    for (std::size_t i = 0; i <= n; ++i) {
+        append_num(out, path[i]);
+        if (i < n) out += " -> ";
+    }
+    return out;
+}
+
+using Kernel = std::string (*)(const View&, Scratch&);
+
+Kernel kernel_for(AlgorithmId id) noexcept {
+    switch (id) {
+    case AlgorithmId::Mst:      return &mst;
+    case AlgorithmId::Scc:      return &scc;
+    case AlgorithmId::MaxFlow:  return &maxflow;
+    case AlgorithmId::Hamilton: return &hamilton;
+    default:                    return nullptr;
+    }
+}
+} // namespace
+
+// --------------------------
+// arena
+// --------------------------
+std::size_t SmallGraphBatch::addGraph(std::size_t n, bool directed) {
+    if (n == 0 || n > kMaxVertices)
+        throw std::invalid_argument("small graphs need 1..64 vertices");
+    m_graphs.push_back(Entry{ m_rows.size(), m_arcs.size(), 0, static_cast<std::uint8_t>(n), directed });
+    m_rows.resize(m_rows.size() + n, 0);
+    return m_graphs.size() - 1;
+}
+
+bool SmallGraphBatch::addEdge(std::size_t u, std::size_t v, Graph::Weight w) {
+    if (m_graphs.empty()) return false;
+    Entry& e = m_graphs.back();
+    if (u >= e.n || v >= e.n || u == v) return false;         // bad endpoints / self-loop
+    Mask* rows = m_rows.data() + e.row;
+    if ((rows[u] >> v) & 1) return false;                     // duplicate
+    if (!e.directed && ((rows[v] >> u) & 1)) return false;
+    rows[u] |= Mask(1) << v;
+    if (!e.directed) rows[v] |= Mask(1) << u;
+    m_arcs.push_back(Arc{ static_cast<std::uint8_t>(u), static_cast<std::uint8_t>(v), w });
+    ++e.arcs;
+    return true;
+}
+
+void SmallGraphBatch::clear() noexcept {
+    m_graphs.clear();
+    m_rows.clear();
+    m_arcs.clear();
+}
+
+Graph SmallGraphBatch::graph(std::size_t i) const {
+    const Entry& e = m_graphs[i];
+    Graph g(e.n, e.directed ? Graph::Kind::Directed : Graph::Kind::Undirected);
+    for (std::size_t k = 0; k < e.arcs; ++k) {
+        const Arc& a = m_arcs[e.arc + k];
+        g.addEdge(a.u, a.v, a.w);
+    }
+    return g;
+}
+
+// --------------------------
+// run
+// --------------------------
+bool SmallGraphBatch::hasKernel(AlgorithmId id) noexcept { return kernel_for(id) != nullptr; }
+
+std::vector<std::string> SmallGraphBatch::run(AlgorithmId id, unsigned maxThreads) const {
+    std::vector<std::string> out(m_graphs.size());
+    const Kernel k = kernel_for(id);
+    std::vector<std::unique_ptr<Scratch>> scratch(k ? parallel_slots(maxThreads) : 0);
+
+    parallel_for(m_graphs.size(), kGrain, [&](std::size_t lo, std::size_t hi, unsigned slot){
+        if (!k) {                                             // no kernel: regular strategy
+            for (std::size_t i = lo; i < hi; ++i) out[i] = AlgorithmFactory::run(id, graph(i));
+            return;
+        }
+        auto& s = scratch[slot];
+        if (!s) s = std::make_unique<Scratch>();              // once per participant
+        for (std::size_t i = lo; i < hi; ++i) {
+            const Entry& e = m_graphs[i];
+            out[i] = k(View{ e.n, e.directed, m_rows.data() + e.row, m_arcs.data() + e.arc, e.arcs }, *s);
+        }
+    }, maxThreads);
+    return out;
+}
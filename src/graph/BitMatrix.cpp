@@ -0,0 +1,102 @@
+// ==========================
+// BitMatrix.cpp
+// ==========================
+// Packed adjacency matrix declared in graph/BitMatrix.hpp.
+// Kernels walk rows in 64-byte blocks of 8 words; the fixed inner trip
+// count lets the compiler keep each block in vector registers. With GCC on
+// x86-64 every kernel is also cloned for Haswell (AVX2 + POPCNT) and the
+// best clone is chosen once at load time.
+// ==========================
+
+#include "graph/BitMatrix.hpp"   // class declaration
+#include <cstring>               // std::memset
+#include <new>                   // std::bad_alloc
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define BITMATRIX_SIMD __attribute__((target_clones("arch=haswell", "default")))
+#else
+#define BITMATRIX_SIMD
+#endif
+
+namespace {
+using Word = BitMatrix::Word;
+constexpr std::size_t B = BitMatrix::kBlockWords;
+} // namespace
+
+// --------------------------
+// construction
+// --------------------------
+BitMatrix::BitMatrix(std::size_t rows, std::size_t cols)
+    : m_rows(rows), m_cols(cols), m_words(((cols + 63) / 64 + B - 1) / B * B) {
+    const std::size_t bytes = m_rows * m_words * sizeof(Word);
+    if (bytes == 0) return;
+    void* p = std::aligned_alloc(kAlign, bytes);              // size is a multiple of kAlign
+    if (!p) throw std::bad_alloc();
+    std::memset(p, 0, bytes);
+    m_bits.reset(static_cast<Word*>(p));
+}
+
+BitMatrix BitMatrix::fromGraph(const Graph& g) {
+    BitMatrix m(g.n(), g.n());
+    for (Graph::Vertex u = 0; u < g.n(); ++u)
+        for (const auto& e : g.adj(u)) m.set(u, e.first);
+    return m;
+}
+
+const BitMatrix& BitMatrix::of(const Graph& g) {
+    return g.cache().get<BitMatrix>(GraphCache::Slot::BitMatrix, [&]{ return fromGraph(g); });
+}
+
+bool BitMatrix::preferred(const Graph& g) noexcept {
+    const std::size_t n = g.n();
+    if (n > kMaxDense) return false;
+    std::size_t arcs = 0;
+    for (Graph::Vertex u = 0; u < n; ++u) arcs += g.adj(u).size();
+    return n * n <= arcs * 128;                               // n²/8 bytes vs 16 bytes per arc
+}
+
+// --------------------------
+// row kernels
+// --------------------------
+BITMATRIX_SIMD
+void BitMatrix::andRows(Word* dst, const Word* a, const Word* b, std::size_t words) noexcept {
+    for (std::size_t i = 0; i < words; i += B)
+        for (std::size_t j = 0; j < B; ++j) dst[i + j] = a[i + j] & b[i + j];
+}
+
+BITMATRIX_SIMD
+void BitMatrix::orRows(Word* dst, const Word* a, const Word* b, std::size_t words) noexcept {
+    for (std::size_t i = 0; i < words; i += B)
+        for (std::size_t j = 0; j < B; ++j) dst[i + j] = a[i + j] | b[i + j];
+}
+
+BITMATRIX_SIMD
+void BitMatrix::andNotRows(Word* dst, const Word* a, const Word* b, std::size_t words) noexcept {
+    for (std::size_t i = 0; i < words; i += B)
+        for (std::size_t j = 0; j < B; ++j) dst[i + j] = a[i + j] & ~b[i + j];
+}
+
+BITMATRIX_SIMD
+std::size_t BitMatrix::popcount(const Word* a, std::size_t words) noexcept {
+    std::size_t c = 0;
+    for (std::size_t i = 0; i < words; ++i) c += static_cast<std::size_t>(__builtin_popcountll(a[i]));
+    return c;
+}
+
+BITMATRIX_SIMD
+std::size_t BitMatrix::andCount(const Word* a, const Word* b, std::size_t words) noexcept {
+    std::size_t c = 0;
+    for (std::size_t i = 0; i < words; ++i) c += static_cast<std::size_t>(__builtin_popcountll(a[i] & b[i]));
+    return c;
+}
+
+std::size_t BitMatrix::nextSet(const Word* a, std::size_t words, std::size_t from) noexcept {
+    std::size_t w = from / 64;
+    if (w >= words) return npos;
+    Word bits = a[w] & (~Word(0) << (from % 64));             // drop bits below `from`
+    for (;;) {
+        if (bits) return w * 64 + static_cast<std::size_t>(__builtin_ctzll(bits));
+        if (++w == words) return npos;
+        bits = a[w];
+    }
+}
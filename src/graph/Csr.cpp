@@ -0,0 +1,121 @@
+// ==========================
+// Csr.cpp
+// ==========================
+// Builds the flat CSR views declared in graph/Csr.hpp.
+// fromGraph/transposeOf are two-pass: count row sizes, prefix-sum, scatter.
+// ==========================
+
+#include "graph/Csr.hpp"     // Csr declaration
+#include "sys/Topology.hpp"  // MemoryPlacement for cached views
+#include <algorithm>         // std::sort, std::unique for symmetricOf
+#include <stdexcept>         // std::length_error for oversized graphs
+
+// Reject graphs whose ids do not fit the compact Index type.
+static void check_fits(const Graph& g) {
+    if (g.n() > static_cast<std::size_t>(static_cast<Csr::Index>(-1)))
+        throw std::length_error("graph too large for 32-bit CSR ids");
+}
+
+// --------------------------
+// fromGraph
+// --------------------------
+Csr Csr::fromGraph(const Graph& g) {
+    check_fits(g);                                          // ids must fit in 32 bits
+    const std::size_t n = g.n();                            // vertex count
+    Csr c;
+    c.offsets.assign(n + 1, 0);                             // row starts
+    for (Graph::Vertex u = 0; u < n; ++u)                   // prefix sums of out-degrees
+        c.offsets[u + 1] = c.offsets[u] + g.adj(u).size();
+
+    c.targets.resize(c.offsets[n]);                         // one slot per arc
+    c.weights.resize(c.offsets[n]);
+    for (Graph::Vertex u = 0; u < n; ++u) {                 // copy rows in order
+        std::size_t k = c.offsets[u];
+        for (const auto& e : g.adj(u)) {
+            c.targets[k] = static_cast<Index>(e.first);
+            c.weights[k] = e.second;
+            ++k;
+        }
+    }
+    return c;
+}
+
+// --------------------------
+// transposeOf
+// --------------------------
+Csr Csr::transposeOf(const Graph& g) {
+    check_fits(g);                                          // ids must fit in 32 bits
+    const std::size_t n = g.n();                            // vertex count
+    Csr c;
+    c.offsets.assign(n + 1, 0);                             // row starts
+    for (Graph::Vertex u = 0; u < n; ++u)                   // count in-degrees (shifted by one)
+        for (const auto& e : g.adj(u)) ++c.offsets[e.first + 1];
+    for (std::size_t v = 0; v < n; ++v)                     // prefix sums
+        c.offsets[v + 1] += c.offsets[v];
+
+    c.targets.resize(c.offsets[n]);                         // one slot per arc
+    c.weights.resize(c.offsets[n]);
+    std::vector<std::size_t> fill(c.offsets.begin(), c.offsets.end() - 1); // write cursor per row
+    for (Graph::Vertex u = 0; u < n; ++u) {                 // scatter u into each target's row
+        for (const auto& e : g.adj(u)) {
+            const std::size_t k = fill[e.first]++;
+            c.targets[k] = static_cast<Index>(u);           // sources appear in ascending order
+            c.weights[k] = e.second;
+        }
+    }
+    return c;
+}
+
+// --------------------------
+// symmetricOf
+// --------------------------
+// Union of out-arcs (u -> v) and in-arcs (v -> u) per row, sorted, deduplicated.
+static Csr merge_directions(const Csr& out, const Csr& in) {
+    const std::size_t n = out.n();
+    Csr c;
+    c.offsets.assign(n + 1, 0);
+    c.targets.reserve(out.arcs() + in.arcs());              // upper bound before dedup
+    for (std::size_t u = 0; u < n; ++u) {
+        const std::size_t start = c.targets.size();         // row start
+        c.targets.insert(c.targets.end(), out.targets.begin() + out.offsets[u], out.targets.begin() + out.offsets[u + 1]);
+        c.targets.insert(c.targets.end(), in.targets.begin() + in.offsets[u], in.targets.begin() + in.offsets[u + 1]);
+        std::sort(c.targets.begin() + start, c.targets.end());             // merge both directions
+        c.targets.erase(std::unique(c.targets.begin() + start, c.targets.end()), c.targets.end());
+        c.offsets[u + 1] = c.targets.size();                // row end
+    }
+    return c;
+}
+
+Csr Csr::symmetricOf(const Graph& g) {
+    if (!g.directed()) return fromGraph(g);                 // already symmetric
+    return merge_directions(fromGraph(g), transposeOf(g));
+}
+
+// --------------------------
+// of
+// --------------------------
+// Cached views are read by every algorithm thread: move their arrays as the
+// process-wide graph memory policy says (no-op by default).
+static Csr placed(Csr c) {
+    const MemoryPlacement policy = MemoryPlacement::graphs();
+    if (policy.kind() == MemoryPlacement::Kind::Default) return c;
+    policy.apply(c.offsets.data(), c.offsets.size() * sizeof(std::size_t));
+    policy.apply(c.targets.data(), c.targets.size() * sizeof(Csr::Index));
+    policy.apply(c.weights.data(), c.weights.size() * sizeof(Graph::Weight));
+    return c;                                               // moves keep the buffers (and their pages)
+}
+
+const Csr& Csr::of(const Graph& g, View view) {
+    switch (view) {
+    case View::In:
+        return g.cache().get<Csr>(GraphCache::Slot::CsrIn, [&]{ return placed(transposeOf(g)); });
+    case View::Symmetric:
+        if (!g.directed()) return of(g, View::Out);         // same arcs: share one copy
+        return g.cache().get<Csr>(GraphCache::Slot::CsrSymmetric, [&]{     // reuse both cached directions
+            return placed(merge_directions(of(g, View::Out), of(g, View::In)));
+        });
+    case View::Out:
+        break;
+    }
+    return g.cache().get<Csr>(GraphCache::Slot::CsrOut, [&]{ return placed(fromGraph(g)); });
+}
@@ -25,6 +25,9 @@ bool Graph::removeEdge(Vertex u, Vertex v) {
     checkIndex(u);                          // validate that u is within bounds
     checkIndex(v);                          // validate that v is within bounds
 
+    if (!hasArc(u, v) && !(!directed() && hasArc(v, u))) return false; // nothing to remove
+    invalidate();                           // cached views describe the old edges
+
     bool changed = removeOneArc(u, v);      // try removing arc u->v
     if (!directed()) {                      // if the graph is undirected
         changed = removeOneArc(v, u) || changed; // also remove v->u, combine with previous result
@@ -51,21 +54,53 @@ Graph Graph::reversed() const {
     Graph rev(n(), m_kind, m_opts);         // create a new graph with same size and settings
 
     if (directed()) {                       // if graph is directed
+        if (hasCosts()) rev.m_cost.resize(n()); // costs follow their arcs
         for (Vertex u = 0; u < n(); ++u) {  // iterate over all vertices
-            for (const auto& e : m_adj[u]) {// iterate over adjacency of u
+            for (std::size_t i = 0; i < m_adj[u].size(); ++i) { // iterate over adjacency of u
+                const auto& e = m_adj[u][i];
                 // Insert reversed edge: instead of u->e.first, add e.first->u
                 rev.m_adj[e.first].emplace_back(u, e.second);
+                if (hasCosts()) rev.m_cost[e.first].push_back(m_cost[u][i]);
             }
         }
     } else {
         // For undirected graphs, reversing has no effect
         rev.m_adj = m_adj;                  // copy adjacency as-is
+        rev.m_cost = m_cost;                // and the parallel costs
     }
 
     rev.m_edgesLogical = m_edgesLogical;    // copy the logical edge count
     return rev;                             // return the reversed/copy graph
 }
 
+// --------------------------
+// cached derived views
+// --------------------------
+// Purpose:
+//   Degree arrays and the reversed graph are built on first use and kept in
+//   the artifact cache until the graph changes, so algorithms running on the
+//   same graph (sequentially or in parallel) compute them only once.
+const std::vector<std::size_t>& Graph::outDegree() const {
+    return cache().get<std::vector<std::size_t>>(GraphCache::Slot::OutDegree, [this]{
+        std::vector<std::size_t> d(n());
+        for (Vertex u = 0; u < n(); ++u) d[u] = m_adj[u].size();
+        return d;
+    });
+}
+
+const std::vector<std::size_t>& Graph::inDegree() const {
+    return cache().get<std::vector<std::size_t>>(GraphCache::Slot::InDegree, [this]{
+        std::vector<std::size_t> d(n(), 0);
+        for (Vertex u = 0; u < n(); ++u)
+            for (const auto& e : m_adj[u]) ++d[e.first];
+        return d;
+    });
+}
+
+const Graph& Graph::reversedView() const {
+    return cache().get<Graph>(GraphCache::Slot::Reversed, [this]{ return reversed(); });
+}
+
 // --------------------------
 // label
 // --------------------------
@@ -0,0 +1,213 @@
+// ==========================
+// AsyncLog.cpp
+// ==========================
+// Ring registry and the background drain thread of the asynchronous logger.
+// Producers only touch their own ring (see AsyncLog.hpp); everything here
+// runs on the drain thread or on the rare slow paths (first call of a
+// thread, flush, shutdown).
+
+#include "log/AsyncLog.hpp"
+
+#include <algorithm>           // std::stable_sort, std::remove_if
+#include <condition_variable>  // drain wake-ups and flush completion
+#include <memory>              // std::shared_ptr rings
+#include <mutex>               // registry lock
+#include <thread>              // drain thread
+#include <vector>              // ring list, drained batch
+
+namespace {
+
+constexpr auto kDrainInterval = std::chrono::milliseconds(5);   // idle polling period
+
+struct RingEntry {
+    std::shared_ptr<LogRing> ring;        // shared with the owning thread
+    std::uint64_t reportedDropped = 0;    // drop count already reported
+    std::uint64_t reportedSuppressed = 0; // suppressed count already reported
+};
+
+struct LoggerState {
+    std::mutex mu;                        // guards everything below
+    std::condition_variable wake;         // flush requests / stop
+    std::condition_variable done;         // flush completion
+    std::vector<RingEntry> rings;         // one per thread that has logged
+    std::FILE* sink = stdout;             // destination of formatted lines
+    std::thread drainer;                  // background thread (started lazily)
+    bool stop = false;                    // drainer should exit
+    std::uint64_t flushRequested = 0;     // flush tickets handed out
+    std::uint64_t flushCompleted = 0;     // tickets whose rounds have finished
+    AsyncLog::Stats stats;                // totals
+
+    ~LoggerState();                       // final drain at process exit
+};
+
+LoggerState& state() {
+    static LoggerState s;
+    return s;
+}
+
+// Marks the thread's ring retired when the thread exits; the drainer frees it once empty.
+struct RingOwner {
+    std::shared_ptr<LogRing> ring;
+    ~RingOwner() { if (ring) ring->retired.store(true, std::memory_order_release); }
+};
+
+const char* levelPrefix(LogLevel level) {
+    switch (level) {
+        case LogLevel::Debug: return "[debug] ";
+        case LogLevel::Warn:  return "[warn] ";
+        case LogLevel::Error: return "[error] ";
+        default:              return "";
+    }
+}
+
+// Expand "{}" placeholders of one record into `out`.
+void format(const LogRecord& r, std::string& out) {
+    out += levelPrefix(r.level);
+    std::size_t arg = 0, text = 0;                                   // next argument, next string
+    for (const char* p = r.fmt; *p; ++p) {
+        if (p[0] != '{' || p[1] != '}' || arg >= r.nargs) { out += *p; continue; }
+        ++p;                                                         // consume "{}"
+        const std::int64_t v = r.args[arg];
+        switch (r.kinds[arg++]) {
+            case LogRecord::Int:  out += std::to_string(v); break;
+            case LogRecord::Uint: out += std::to_string((std::uint64_t)v); break;
+            case LogRecord::Str:
+            case LogRecord::StrCut:
+                out.append(r.text + text, (std::size_t)v);
+                text += (std::size_t)v + 1;
+                if (r.kinds[arg - 1] == LogRecord::StrCut) out += " ...";
+                break;
+        }
+    }
+    out += '\n';
+}
+
+// One round: empty every ring, write the lines in timestamp order, report losses.
+void drainOnce(LoggerState& st) {
+    std::vector<LogRecord> batch;
+    std::uint64_t newDropped = 0, newSuppressed = 0;
+    std::FILE* sink;
+    {
+        std::lock_guard<std::mutex> lk(st.mu);
+        sink = st.sink;
+        for (RingEntry& e : st.rings) {
+            LogRing& ring = *e.ring;
+            const std::uint64_t h = ring.head.load(std::memory_order_acquire);
+            std::uint64_t t = ring.tail.load(std::memory_order_relaxed);
+            for (; t != h; ++t) batch.push_back(ring.slots[t & (LogRing::kCapacity - 1)]);
+            ring.tail.store(h, std::memory_order_release);           // slots may be reused
+
+            const std::uint64_t d = ring.dropped.load(std::memory_order_relaxed);
+            const std::uint64_t s = ring.suppressed.load(std::memory_order_relaxed);
+            newDropped    += d - e.reportedDropped;    e.reportedDropped = d;
+            newSuppressed += s - e.reportedSuppressed; e.reportedSuppressed = s;
+        }
+        // Rings of exited threads: free once nothing can be written any more.
+        st.rings.erase(std::remove_if(st.rings.begin(), st.rings.end(), [](const RingEntry& e) {
+                           return e.ring->retired.load(std::memory_order_acquire) &&
+                                  e.ring->head.load(std::memory_order_acquire) ==
+                                      e.ring->tail.load(std::memory_order_relaxed);
+                       }),
+                       st.rings.end());
+    }
+    if (batch.empty() && newDropped == 0 && newSuppressed == 0) return;
+
+    std::stable_sort(batch.begin(), batch.end(),
+                     [](const LogRecord& a, const LogRecord& b) { return a.ns < b.ns; });
+    std::string out;
+    out.reserve(batch.size() * 64);
+    for (const LogRecord& r : batch) format(r, out);
+    if (newDropped || newSuppressed)
+        out += "[log] " + std::to_string(newDropped) + " records dropped (ring full), " +
+               std::to_string(newSuppressed) + " suppressed by rate limits\n";
+    std::fwrite(out.data(), 1, out.size(), sink);                    // one write per round
+    std::fflush(sink);
+
+    std::lock_guard<std::mutex> lk(st.mu);
+    st.stats.written    += batch.size();
+    st.stats.dropped    += newDropped;
+    st.stats.suppressed += newSuppressed;
+}
+
+void drainLoop() {
+    LoggerState& st = state();
+    std::unique_lock<std::mutex> lk(st.mu);
+    for (;;) {
+        st.wake.wait_for(lk, kDrainInterval,
+                         [&] { return st.stop || st.flushRequested != st.flushCompleted; });
+        const bool stopping = st.stop;
+        const std::uint64_t ticket = st.flushRequested;              // covers calls made before now
+        lk.unlock();
+        drainOnce(st);
+        lk.lock();
+        st.flushCompleted = ticket;
+        st.done.notify_all();
+        if (stopping) break;
+    }
+}
+
+// Start the drain thread if it is not running (caller holds st.mu).
+void ensureDrainer(LoggerState& st) {
+    if (st.drainer.joinable()) return;
+    st.stop = false;
+    st.drainer = std::thread(drainLoop);
+}
+
+// Let the drain thread run one last round, then join it.
+void stopDrainer(LoggerState& st) {
+    std::thread t;
+    {
+        std::lock_guard<std::mutex> lk(st.mu);
+        if (!st.drainer.joinable()) return;
+        st.stop = true;                                              // final round drains everything
+        t = std::move(st.drainer);
+    }
+    st.wake.notify_one();
+    t.join();
+    std::lock_guard<std::mutex> lk(st.mu);
+    st.done.notify_all();                                            // release late flush() callers
+}
+
+LoggerState::~LoggerState() { stopDrainer(*this); }
+
+} // namespace
+
+LogRing& AsyncLog::attachThread() {
+    static thread_local RingOwner owner;
+    owner.ring = std::make_shared<LogRing>();
+    LoggerState& st = state();
+    {
+        std::lock_guard<std::mutex> lk(st.mu);
+        st.rings.push_back(RingEntry{owner.ring});
+        ensureDrainer(st);
+    }
+    t_ring = owner.ring.get();
+    return *t_ring;
+}
+
+void AsyncLog::setSink(std::FILE* sink) {
+    flush();                                                         // old lines go to the old sink
+    LoggerState& st = state();
+    std::lock_guard<std::mutex> lk(st.mu);
+    st.sink = sink ? sink : stdout;
+}
+
+void AsyncLog::flush() {
+    LoggerState& st = state();
+    std::unique_lock<std::mutex> lk(st.mu);
+    if (st.rings.empty()) return;                                    // nothing was ever logged
+    ensureDrainer(st);                                               // restart after shutdown()
+    const std::uint64_t ticket = ++st.flushRequested;
+    st.wake.notify_one();
+    st.done.wait(lk, [&] { return st.flushCompleted >= ticket || !st.drainer.joinable(); });
+}
+
+void AsyncLog::shutdown() {
+    stopDrainer(state());
+}
+
+AsyncLog::Stats AsyncLog::stats() {
+    LoggerState& st = state();
+    std::lock_guard<std::mutex> lk(st.mu);
+    return st.stats;
+}
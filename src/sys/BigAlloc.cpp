@@ -0,0 +1,112 @@
+// ==========================
+// BigAlloc.cpp
+// ==========================
+// mmap-backed big blocks with transparent / explicit huge pages, declared
+// in sys/BigAlloc.hpp.
+// ==========================
+
+#include "sys/BigAlloc.hpp"      // BigAlloc, BigAllocator
+
+#include <sys/mman.h>            // mmap, munmap, madvise
+
+#include <atomic>                // policy + counters
+#include <cstdint>               // std::uintptr_t alignment arithmetic
+#include <stdexcept>             // std::invalid_argument
+
+#ifndef MAP_HUGETLB
+#define MAP_HUGETLB 0x40000      // linux/mman.h
+#endif
+
+namespace {
+
+std::atomic<int>           g_mode{static_cast<int>(BigAlloc::Mode::Thp)};
+std::atomic<bool>          g_prefault{false};
+std::atomic<std::uint64_t> g_blocks{0}, g_bytes{0}, g_hugetlb{0}, g_fallbacks{0};
+
+std::size_t round_up(std::size_t bytes) {
+    return (bytes + BigAlloc::kHugePage - 1) & ~(BigAlloc::kHugePage - 1);
+}
+
+// Anonymous mapping of `len` bytes (a multiple of kHugePage) starting on a
+// kHugePage boundary: over-map by one huge page and trim both ends.
+void* map_aligned(std::size_t len) {
+    const std::size_t over = len + BigAlloc::kHugePage;
+    void* raw = ::mmap(nullptr, over, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return nullptr;
+    const std::uintptr_t base  = reinterpret_cast<std::uintptr_t>(raw);
+    const std::uintptr_t start = (base + BigAlloc::kHugePage - 1) & ~(std::uintptr_t)(BigAlloc::kHugePage - 1);
+    if (start > base) ::munmap(raw, start - base);                   // head
+    if (start + len < base + over) ::munmap(reinterpret_cast<void*>(start + len), base + over - start - len); // tail
+    return reinterpret_cast<void*>(start);
+}
+
+} // namespace
+
+BigAlloc::Policy BigAlloc::parse(const std::string& spec) {
+    Policy p;
+    std::string mode = spec;
+    const std::string suffix = "+prefault";
+    if (mode.size() > suffix.size() && mode.compare(mode.size() - suffix.size(), suffix.size(), suffix) == 0) {
+        p.prefault = true;
+        mode.resize(mode.size() - suffix.size());
+    }
+    if (mode == "off")          p.mode = Mode::Off;
+    else if (mode == "thp")     p.mode = Mode::Thp;
+    else if (mode == "hugetlb") p.mode = Mode::HugeTlb;
+    else throw std::invalid_argument("unknown huge page policy: " + spec);
+    return p;
+}
+
+std::string BigAlloc::describe(const Policy& p) {
+    const char* mode = p.mode == Mode::Off ? "off" : p.mode == Mode::Thp ? "thp" : "hugetlb";
+    return std::string(mode) + (p.prefault ? "+prefault" : "");
+}
+
+void BigAlloc::setPolicy(const Policy& p) noexcept {
+    g_mode.store(static_cast<int>(p.mode), std::memory_order_relaxed);
+    g_prefault.store(p.prefault, std::memory_order_relaxed);
+}
+
+BigAlloc::Policy BigAlloc::policy() noexcept {
+    return Policy{ static_cast<Mode>(g_mode.load(std::memory_order_relaxed)),
+                   g_prefault.load(std::memory_order_relaxed) };
+}
+
+BigAlloc::Stats BigAlloc::stats() noexcept {
+    return Stats{ g_blocks.load(), g_bytes.load(), g_hugetlb.load(), g_fallbacks.load() };
+}
+
+void* BigAlloc::map(std::size_t bytes) {
+    const Policy pol = policy();
+    const std::size_t len = round_up(bytes);
+    const int populate = pol.prefault ? MAP_POPULATE : 0;
+    void* p = nullptr;
+
+    if (pol.mode == Mode::HugeTlb) {                                 // reserved pool: aligned by construction
+        p = ::mmap(nullptr, len, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | populate, -1, 0);
+        if (p == MAP_FAILED) { p = nullptr; ++g_fallbacks; }
+        else ++g_hugetlb;
+    }
+    if (!p) {
+        p = map_aligned(len);
+        if (!p) throw std::bad_alloc();
+        if (pol.mode != Mode::Off) ::madvise(p, len, MADV_HUGEPAGE); // before the first touch
+        if (populate) {                                              // MAP_POPULATE would fault before madvise:
+                                                                     // touch instead, one write per small page
+            volatile char* c = static_cast<char*>(p);
+            for (std::size_t off = 0; off < len; off += 4096) c[off] = 0;
+        }
+    }
+    ++g_blocks;
+    g_bytes += len;
+    return p;
+}
+
+void BigAlloc::unmap(void* p, std::size_t bytes) noexcept {
+    if (!p) return;
+    const std::size_t len = round_up(bytes);
+    ::munmap(p, len);
+    --g_blocks;
+    g_bytes -= len;
+}
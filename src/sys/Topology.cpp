@@ -0,0 +1,322 @@
+// ==========================
+// Topology.cpp
+// ==========================
+// sysfs topology discovery, CPU pinning (sched/pthread affinity) and page
+// placement (raw mbind syscall, so no libnuma is needed) declared in
+// sys/Topology.hpp.
+// ==========================
+
+#include "sys/Topology.hpp"      // Topology, CpuPlacement, MemoryPlacement
+
+#include <pthread.h>             // pthread_setaffinity_np
+#include <sched.h>               // cpu_set_t, sched_getaffinity, sched_getcpu
+#include <sys/syscall.h>         // SYS_mbind
+#include <unistd.h>              // syscall, sysconf
+
+#include <algorithm>             // std::sort, std::unique, std::find_if
+#include <cstdint>               // std::uintptr_t page arithmetic
+#include <filesystem>            // node directory listing
+#include <fstream>               // cpulist files
+#include <mutex>                 // graph policy guard
+#include <stdexcept>             // std::invalid_argument
+
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1         // linux/mempolicy.h
+#endif
+#ifndef MPOL_INTERLEAVE
+#define MPOL_INTERLEAVE 3
+#endif
+#ifndef MPOL_MF_MOVE
+#define MPOL_MF_MOVE (1 << 1)    // migrate pages already in the range
+#endif
+
+namespace {
+
+// Non-negative integer spanning all of `s`, or -1.
+int parse_id(std::string_view s) {
+    if (s.empty() || s.size() > 9) return -1;
+    int v = 0;
+    for (char c : s) {
+        if (c < '0' || c > '9') return -1;
+        v = v * 10 + (c - '0');
+    }
+    return v;
+}
+
+// Remove whitespace at both ends (sysfs files end with '\n').
+std::string_view trim(std::string_view s) {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\n' || s.front() == '\t')) s.remove_prefix(1);
+    while (!s.empty() && (s.back()  == ' ' || s.back()  == '\n' || s.back()  == '\t')) s.remove_suffix(1);
+    return s;
+}
+
+// CPUs the process may run on (empty when unknown).
+std::vector<int> allowed_cpus() {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::sched_getaffinity(0, sizeof(set), &set) != 0) return {};
+    std::vector<int> cpus;
+    for (int c = 0; c < CPU_SETSIZE; ++c)
+        if (CPU_ISSET(c, &set)) cpus.push_back(c);
+    return cpus;
+}
+
+bool set_affinity(pthread_t t, const std::vector<int>& cpus) {
+    if (cpus.empty()) return true;                          // unpinned
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int c : cpus)
+        if (c >= 0 && c < CPU_SETSIZE) CPU_SET(c, &set);
+    return ::pthread_setaffinity_np(t, sizeof(set), &set) == 0;
+}
+
+// "node:N" -> N, "cpus:LIST" -> LIST: text after the prefix, or npos.
+std::size_t after_prefix(const std::string& spec, std::string_view prefix) {
+    return spec.compare(0, prefix.size(), prefix) == 0 ? prefix.size() : std::string::npos;
+}
+
+std::mutex        g_graphs_mu;           // guards g_graphs
+MemoryPlacement   g_graphs;              // policy for cached graph views
+
+} // namespace
+
+// --------------------------
+// Topology
+// --------------------------
+std::vector<int> parse_cpu_list(std::string_view text) {
+    std::vector<int> cpus;
+    text = trim(text);
+    while (!text.empty()) {
+        const std::size_t comma = text.find(',');
+        const std::string_view item = text.substr(0, comma);
+        text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+
+        const std::size_t dash = item.find('-');
+        const int lo = parse_id(item.substr(0, dash));
+        const int hi = dash == std::string_view::npos ? lo : parse_id(item.substr(dash + 1));
+        if (lo < 0 || hi < lo) throw std::invalid_argument("bad cpu list entry: " + std::string(item));
+        for (int c = lo; c <= hi; ++c) cpus.push_back(c);
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+Topology Topology::fromSysfs(const std::string& root, const std::vector<int>& allowed) {
+    namespace fs = std::filesystem;
+    Topology topo;
+    std::error_code ec;
+    for (fs::directory_iterator it(fs::path(root) / "node", ec), end; !ec && it != end; it.increment(ec)) {
+        const std::string name = it->path().filename().string();
+        if (name.compare(0, 4, "node") != 0) continue;      // "possible", "online", ...
+        const int id = parse_id(std::string_view(name).substr(4));
+        if (id < 0) continue;
+
+        std::ifstream in(it->path() / "cpulist");
+        if (!in) continue;
+        std::string line;
+        std::getline(in, line);
+        Node node{id, {}};
+        try { node.cpus = parse_cpu_list(line); } catch (const std::invalid_argument&) { continue; }
+        if (!allowed.empty())                               // keep CPUs we may use
+            node.cpus.erase(std::remove_if(node.cpus.begin(), node.cpus.end(), [&](int c) {
+                                return !std::binary_search(allowed.begin(), allowed.end(), c);
+                            }),
+                            node.cpus.end());
+        topo.nodes.push_back(std::move(node));
+    }
+    std::sort(topo.nodes.begin(), topo.nodes.end(), [](const Node& a, const Node& b) { return a.id < b.id; });
+
+    if (topo.cpuNodes() == 0) {                             // no NUMA info: one flat node
+        topo.nodes.clear();
+        topo.nodes.push_back(Node{0, allowed});
+    }
+    return topo;
+}
+
+const Topology& Topology::system() {
+    static const Topology topo = [] {
+        std::vector<int> allowed = allowed_cpus();
+        if (allowed.empty()) {                              // affinity unknown: assume 0..n-1
+            const long n = ::sysconf(_SC_NPROCESSORS_ONLN);
+            for (long c = 0; c < std::max(1L, n); ++c) allowed.push_back((int)c);
+        }
+        return fromSysfs("/sys/devices/system", allowed);
+    }();
+    return topo;
+}
+
+std::vector<int> Topology::cpus() const {
+    std::vector<int> all;
+    for (const Node& n : nodes) all.insert(all.end(), n.cpus.begin(), n.cpus.end());
+    return all;
+}
+
+int Topology::nodeOf(int cpu) const {
+    for (const Node& n : nodes)
+        if (std::binary_search(n.cpus.begin(), n.cpus.end(), cpu)) return n.id;
+    return -1;
+}
+
+std::size_t Topology::cpuNodes() const {
+    return (std::size_t)std::count_if(nodes.begin(), nodes.end(), [](const Node& n) { return !n.cpus.empty(); });
+}
+
+// --------------------------
+// Thread pinning
+// --------------------------
+bool pin_thread(std::thread& t, const std::vector<int>& cpus) {
+    return t.joinable() && set_affinity(t.native_handle(), cpus);
+}
+
+bool pin_this_thread(const std::vector<int>& cpus) {
+    return set_affinity(::pthread_self(), cpus);
+}
+
+CpuPlacement CpuPlacement::parse(const std::string& spec) {
+    CpuPlacement p;
+    if (spec == "none" || spec.empty()) return p;
+    if (spec == "compact") { p.m_kind = Kind::Compact; return p; }
+    if (spec == "scatter") { p.m_kind = Kind::Scatter; return p; }
+    if (std::size_t at = after_prefix(spec, "node:"); at != std::string::npos) {
+        p.m_node = parse_id(std::string_view(spec).substr(at));
+        if (p.m_node < 0) throw std::invalid_argument("bad node in cpu placement: " + spec);
+        p.m_kind = Kind::Node;
+        return p;
+    }
+    if (std::size_t at = after_prefix(spec, "cpus:"); at != std::string::npos) {
+        p.m_list = parse_cpu_list(std::string_view(spec).substr(at));
+        if (p.m_list.empty()) throw std::invalid_argument("empty cpu list: " + spec);
+        p.m_kind = Kind::List;
+        return p;
+    }
+    throw std::invalid_argument("unknown cpu placement: " + spec);
+}
+
+std::string CpuPlacement::describe() const {
+    switch (m_kind) {
+        case Kind::Compact: return "compact";
+        case Kind::Scatter: return "scatter";
+        case Kind::Node:    return "node:" + std::to_string(m_node);
+        case Kind::List: {
+            std::string s = "cpus:";
+            for (std::size_t i = 0; i < m_list.size(); ++i) s += (i ? "," : "") + std::to_string(m_list[i]);
+            return s;
+        }
+        case Kind::None:    break;
+    }
+    return "none";
+}
+
+std::vector<int> CpuPlacement::cpusFor(unsigned index, const Topology& topo) const {
+    switch (m_kind) {
+        case Kind::None:
+            return {};
+        case Kind::Compact: {
+            const std::vector<int> all = topo.cpus();
+            if (all.empty()) return {};
+            return { all[index % all.size()] };
+        }
+        case Kind::Scatter: {
+            std::vector<const Topology::Node*> withCpus;
+            for (const Topology::Node& n : topo.nodes)
+                if (!n.cpus.empty()) withCpus.push_back(&n);
+            if (withCpus.empty()) return {};
+            const Topology::Node& n = *withCpus[index % withCpus.size()];
+            return { n.cpus[(index / withCpus.size()) % n.cpus.size()] };
+        }
+        case Kind::Node: {
+            auto it = std::find_if(topo.nodes.begin(), topo.nodes.end(),
+                                   [&](const Topology::Node& n) { return n.id == m_node; });
+            return it == topo.nodes.end() ? std::vector<int>{} : it->cpus;
+        }
+        case Kind::List:
+            return { m_list[index % m_list.size()] };
+    }
+    return {};
+}
+
+bool CpuPlacement::pin(std::thread& t, unsigned index, const Topology& topo) const {
+    return m_kind == Kind::None || pin_thread(t, cpusFor(index, topo));
+}
+
+bool CpuPlacement::pinThis(unsigned index, const Topology& topo) const {
+    return m_kind == Kind::None || pin_this_thread(cpusFor(index, topo));
+}
+
+// --------------------------
+// Memory placement
+// --------------------------
+MemoryPlacement MemoryPlacement::parse(const std::string& spec) {
+    MemoryPlacement p;
+    if (spec == "default" || spec.empty()) return p;
+    if (spec == "local")      { p.m_kind = Kind::Local; return p; }
+    if (spec == "interleave") { p.m_kind = Kind::Interleave; return p; }
+    if (std::size_t at = after_prefix(spec, "node:"); at != std::string::npos) {
+        p.m_node = parse_id(std::string_view(spec).substr(at));
+        if (p.m_node < 0) throw std::invalid_argument("bad node in memory placement: " + spec);
+        p.m_kind = Kind::Node;
+        return p;
+    }
+    throw std::invalid_argument("unknown memory placement: " + spec);
+}
+
+std::string MemoryPlacement::describe() const {
+    switch (m_kind) {
+        case Kind::Local:      return "local";
+        case Kind::Node:       return "node:" + std::to_string(m_node);
+        case Kind::Interleave: return "interleave";
+        case Kind::Default:    break;
+    }
+    return "default";
+}
+
+bool MemoryPlacement::apply(const void* p, std::size_t bytes, const Topology& topo) const {
+    if (m_kind == Kind::Default || p == nullptr) return true;
+
+    // Only whole pages inside the range: never move a neighbour's page.
+    const std::uintptr_t page = (std::uintptr_t)::sysconf(_SC_PAGESIZE);
+    const std::uintptr_t lo = ((std::uintptr_t)p + page - 1) & ~(page - 1);
+    const std::uintptr_t hi = ((std::uintptr_t)p + bytes) & ~(page - 1);
+    if (hi <= lo) return true;                              // smaller than a page
+
+    std::vector<int> target;                                // nodes of the policy
+    int mode = MPOL_PREFERRED;
+    switch (m_kind) {
+        case Kind::Local: {
+            const int cpu = ::sched_getcpu();
+            const int node = cpu < 0 ? -1 : topo.nodeOf(cpu);
+            if (node < 0) return false;
+            target.push_back(node);
+            break;
+        }
+        case Kind::Node:
+            target.push_back(m_node);
+            break;
+        case Kind::Interleave:
+            mode = MPOL_INTERLEAVE;
+            for (const Topology::Node& n : topo.nodes) target.push_back(n.id);
+            break;
+        case Kind::Default:
+            return true;
+    }
+
+    constexpr std::size_t kBits = 8 * sizeof(unsigned long);
+    const int maxNode = *std::max_element(target.begin(), target.end());
+    std::vector<unsigned long> mask((std::size_t)maxNode / kBits + 1, 0);
+    for (int n : target) mask[(std::size_t)n / kBits] |= 1UL << ((std::size_t)n % kBits);
+
+    // maxnode counts bits plus one (the kernel ignores the last bit it is given).
+    return ::syscall(SYS_mbind, (void*)lo, (unsigned long)(hi - lo), (unsigned long)mode, mask.data(),
+                     (unsigned long)(mask.size() * kBits + 1), (unsigned)MPOL_MF_MOVE) == 0;
+}
+
+void MemoryPlacement::setGraphs(const MemoryPlacement& policy) {
+    std::lock_guard<std::mutex> lk(g_graphs_mu);
+    g_graphs = policy;
+}
+
+MemoryPlacement MemoryPlacement::graphs() {
+    std::lock_guard<std::mutex> lk(g_graphs_mu);
+    return g_graphs;
+}
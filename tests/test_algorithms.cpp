@@ -3,6 +3,40 @@
 #include "doctest.h"
 #include "graph/Graph.hpp"
 #include "algo/GraphAlgorithm.hpp"
+#include "algo/PageRank.hpp"
+#include "algo/Matching.hpp"
+#include "algo/Biconnected.hpp"
+#include "algo/Scc.hpp"
+#include "algo/Reachability.hpp"
+#include "algo/MinCostFlow.hpp"
+#include "algo/MultiSourceBfs.hpp"
+#include "algo/Betweenness.hpp"
+#include "algo/Coloring.hpp"
+#include "algo/FrontierApps.hpp"
+#include "algo/MaxClique.hpp"
+#include "algo/Parallel.hpp"
+#include "algo/ShortestPaths.hpp"
+#include "algo/SmallGraphBatch.hpp"
+#include "algo/SparseLinear.hpp"
+#include "graph/BitMatrix.hpp"
+#include "graph/Csr.hpp"
+#include "log/AsyncLog.hpp"
+#include "sys/BigAlloc.hpp"
+#include "sys/Topology.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <sched.h>
 
 // Small helper to create & run an algorithm by name
 static std::string run_algo(const char* name, const Graph& g) {
@@ -94,6 +128,997 @@ TEST_CASE("SCC count = 1 on strongly-connected 3-cycle") {
     CHECK(out.find("SCC count: 1") != std::string::npos);
 }
 
+TEST_CASE("SCC condensation is a deduplicated DAG in topological order") {
+    Graph g(6, Graph::Kind::Directed);
+    g.addEdge(0,1); g.addEdge(1,0);                    // C1 = {0,1}
+    g.addEdge(2,3); g.addEdge(3,2);                    // C2 = {2,3}
+    g.addEdge(0,2); g.addEdge(1,3);                    // two arcs C1 -> C2 (deduplicated)
+    g.addEdge(3,4); g.addEdge(5,0);                    // {4} sink, {5} source
+
+    StrongComponents::Options o; o.condensation = true;
+    auto r = StrongComponents(o).compute(g);
+    REQUIRE(r.count == 4);
+    CHECK(r.component[0] == r.component[1]);
+    CHECK(r.component[2] == r.component[3]);
+    CHECK(r.dagArcs() == 3);
+    for (std::size_t c = 0; c < r.count; ++c)          // every arc goes forward in the order
+        for (std::size_t p = r.dagOffsets[c]; p < r.dagOffsets[c + 1]; ++p)
+            CHECK(c < r.dagTargets[p]);
+    CHECK(r.component[5] == 0);
+    CHECK(r.component[4] == 3);
+
+    auto out = run_algo("SCC:dag", g);
+    CHECK(out.find("SCC count: 4.") != std::string::npos);
+    CHECK(out.find("condensation DAG (3 arcs)") != std::string::npos);
+}
+
+// ---------------- Reachability ----------------
+
+TEST_CASE("Reachability closure and interval indexes agree with BFS") {
+    std::mt19937 rng(7);
+    const std::size_t n = 60;
+    Graph g(n, Graph::Kind::Directed);
+    for (int i = 0; i < 120; ++i) {                    // sparse random digraph with a few cycles
+        auto u = rng() % n, v = rng() % n;
+        if (u != v && !g.hasArc(u, v)) g.addEdge(u, v);
+    }
+
+    std::vector<std::pair<Graph::Vertex, Graph::Vertex>> q;
+    std::vector<char> truth;
+    for (Graph::Vertex s = 0; s < n; ++s) {            // ground truth by BFS from every vertex
+        std::vector<char> seen(n, 0); std::vector<Graph::Vertex> bfs{ s }; seen[s] = 1;
+        for (std::size_t i = 0; i < bfs.size(); ++i)
+            for (const auto& e : g.adj(bfs[i])) if (!seen[e.first]) { seen[e.first] = 1; bfs.push_back(e.first); }
+        for (Graph::Vertex t = 0; t < n; ++t) { q.emplace_back(s, t); truth.push_back(seen[t]); }
+    }
+
+    for (auto mode : { ReachabilityIndex::Mode::Closure, ReachabilityIndex::Mode::Interval }) {
+        ReachabilityIndex::Options o; o.mode = mode;
+        ReachabilityIndex idx(g, o);
+        CHECK(idx.mode() == mode);
+        CHECK(idx.query(q) == truth);
+        CHECK(idx.reachable(q[5].first, q[5].second) == bool(truth[5]));
+    }
+}
+
+TEST_CASE("Reachability strategy answers queries in order and validates vertices") {
+    Graph g(4, Graph::Kind::Directed);
+    g.addEdge(0,1); g.addEdge(1,2); g.addEdge(2,1);    // {1,2} is one SCC, 3 isolated
+    auto out = run_algo("REACH:0-2,2-0,2-1,3-3,1-3", g);
+    CHECK(out.find("3 reachable): 10110") != std::string::npos);
+    CHECK(run_algo("REACH 0-9", g).find("out of range") != std::string::npos);
+    CHECK(AlgorithmFactory::create("REACH") == nullptr);          // no queries
+    CHECK(AlgorithmFactory::create("REACH:0-1,bogus") == nullptr);
+}
+
+// ---------------- Min-cost flow ----------------
+
+TEST_CASE("Min-cost flow prefers cheap paths and honours the flow limit") {
+    Graph g(4, Graph::Kind::Directed);
+    g.addEdge(0,1,1,1); g.addEdge(1,3,2,1);           // cheap path, capacity 1
+    g.addEdge(0,2,1,5); g.addEdge(2,3,1,1);           // expensive path
+    g.addEdge(0,3,1,10);                              // direct but priciest
+
+    auto one = MinCostFlow().compute(g, 0, 3, 1);
+    CHECK(one.flow == 1);
+    CHECK(one.cost == 2);
+    auto all = MinCostFlow().compute(g, 0, 3);
+    CHECK(all.flow == 3);
+    CHECK(all.cost == 2 + 6 + 10);
+    CHECK(all.arcs.size() == 5);
+
+    auto out = run_algo("MINCOSTFLOW:0,3,2", g);
+    CHECK(out.find("flow 2, cost 8") != std::string::npos);
+    CHECK(AlgorithmFactory::create("MINCOSTFLOW 0") == nullptr);  // t missing
+}
+
+TEST_CASE("Min-cost flow handles negative costs and rejects negative cycles") {
+    Graph g(4, Graph::Kind::Directed);
+    g.addEdge(0,1,1,2); g.addEdge(1,3,1,-4);          // negative arc, no cycle
+    g.addEdge(0,2,1,1); g.addEdge(2,3,1,1);
+    auto r = MinCostFlow().compute(g, 0, 3);
+    CHECK(r.flow == 2);
+    CHECK(r.cost == -2 + 2);
+
+    g.addEdge(3,0,1,-1);                              // 0->1->3->0 costs -3
+    CHECK(MinCostFlow().compute(g, 0, 3).negativeCycle);
+    CHECK(run_algo("MINCOSTFLOW", g).find("negative cycle") != std::string::npos);
+
+    Graph bad(2, Graph::Kind::Directed);
+    bad.addEdge(0,1,-5);                              // negative capacity: an error, not a throw
+    CHECK_THROWS_AS(MinCostFlow().compute(bad, 0, 1), std::invalid_argument);
+    CHECK(run_algo("MINCOSTFLOW", bad).find("non-negative") != std::string::npos);
+}
+
+// ---------------- Multi-source BFS ----------------
+
+TEST_CASE("MS-BFS matches single-source BFS across batch widths") {
+    std::mt19937 rng(11);
+    const std::size_t n = 300;                         // several 64-lane batches
+    Graph g(n, Graph::Kind::Directed);
+    for (int i = 0; i < 700; ++i) {
+        auto u = rng() % n, v = rng() % n;
+        if (u != v) g.addEdge(u, v);
+    }
+    for (unsigned width : { 64u, 192u, 512u }) {
+        MultiSourceBfs::Options o; o.width = width;
+        auto r = MultiSourceBfs(o).compute(g);
+        CHECK(r.width <= width);
+        for (Graph::Vertex s = 0; s < n; s += 37) {    // spot-check against a plain BFS
+            std::vector<long> d(n, -1); std::vector<Graph::Vertex> q{ s }; d[s] = 0;
+            std::size_t ecc = 0; std::uint64_t sum = 0;
+            for (std::size_t i = 0; i < q.size(); ++i)
+                for (const auto& e : g.adj(q[i]))
+                    if (d[e.first] < 0) { d[e.first] = d[q[i]] + 1; q.push_back(e.first); ecc = d[e.first]; sum += ecc; }
+            CHECK(r.reached[s] == q.size());
+            CHECK(r.eccentricity[s] == ecc);
+            CHECK(r.distanceSum[s] == sum);
+        }
+    }
+}
+
+TEST_CASE("Distance strategies on a path and a disconnected graph") {
+    Graph path(5, Graph::Kind::Undirected);            // 0-1-2-3-4
+    for (Graph::Vertex v = 0; v + 1 < 5; ++v) path.addEdge(v, v + 1);
+    CHECK(run_algo("DIAMETER", path).find("Diameter: 4, radius: 2; center: 2.") != std::string::npos);
+    CHECK(run_algo("ECCENTRICITY", path).find("0=4 1=3 2=2 3=3 4=4") != std::string::npos);
+    CHECK(run_algo("CLOSENESS", path).find("top: 2=") != std::string::npos);
+
+    Graph two(4, Graph::Kind::Undirected);
+    two.addEdge(0,1); two.addEdge(2,3);
+    CHECK(run_algo("DIAMETER:width=64", two).find("infinite") != std::string::npos);
+    CHECK(AlgorithmFactory::create("DIAMETER:width=1024") == nullptr);
+}
+
+// ---------------- Betweenness ----------------
+
+TEST_CASE("Betweenness is exact on a path, a star and a directed chain") {
+    Graph path(5, Graph::Kind::Undirected);            // 0-1-2-3-4
+    for (Graph::Vertex v = 0; v + 1 < 5; ++v) path.addEdge(v, v + 1);
+    auto p = Betweenness().compute(path);
+    CHECK(p.exact);
+    CHECK(p.score == std::vector<double>{ 0, 3, 4, 3, 0 });
+
+    Graph star(6, Graph::Kind::Undirected);            // center 0, five leaves
+    for (Graph::Vertex v = 1; v < 6; ++v) star.addEdge(0, v);
+    CHECK(Betweenness().compute(star).score[0] == doctest::Approx(10));
+
+    Graph chain(3, Graph::Kind::Directed);             // 0->1->2
+    chain.addEdge(0,1); chain.addEdge(1,2);
+    CHECK(Betweenness().compute(chain).score[1] == doctest::Approx(1));
+    CHECK(run_algo("BETWEENNESS", path).find("exact, 5 sources); top: 2=4.00") != std::string::npos);
+}
+
+TEST_CASE("Sampled betweenness stays within its reported error bound") {
+    std::mt19937 rng(5);
+    const std::size_t n = 120;
+    Graph g(n, Graph::Kind::Undirected);
+    for (int i = 0; i < 400; ++i) {
+        auto u = rng() % n, v = rng() % n;
+        if (u != v) g.addEdge(u, v);
+    }
+    auto exact = Betweenness().compute(g);
+    Betweenness::Options o; o.samples = 40; o.seed = 3;
+    auto est = Betweenness(o).compute(g);
+    CHECK_FALSE(est.exact);
+    CHECK(est.sources == 40);
+    REQUIRE(est.errorBound > 0);
+    for (std::size_t v = 0; v < n; ++v) CHECK(std::abs(est.score[v] - exact.score[v]) <= est.errorBound);
+    CHECK(run_algo("BETWEENNESS:eps=0.2", g).find("approximate") != std::string::npos);
+    CHECK(AlgorithmFactory::create("BETWEENNESS:samples=0") == nullptr);
+}
+
+// ---------------- Coloring ----------------
+
+TEST_CASE("DSatur is optimal on bipartite grids and cliques") {
+    Graph grid(12, Graph::Kind::Undirected);           // 3x4 grid
+    for (Graph::Vertex r = 0; r < 3; ++r)
+        for (Graph::Vertex c = 0; c < 4; ++c) {
+            if (c + 1 < 4) grid.addEdge(r * 4 + c, r * 4 + c + 1);
+            if (r + 1 < 3) grid.addEdge(r * 4 + c, (r + 1) * 4 + c);
+        }
+    CHECK(GraphColoring().compute(grid).colors == 2);
+
+    Graph k5(5, Graph::Kind::Directed);                // direction is ignored
+    for (Graph::Vertex u = 0; u < 5; ++u)
+        for (Graph::Vertex v = u + 1; v < 5; ++v) k5.addEdge(u, v);
+    CHECK(GraphColoring().compute(k5).colors == 5);
+    CHECK(run_algo("COLORING", k5).find("5 colors; 0=") != std::string::npos);
+}
+
+TEST_CASE("Every coloring method yields a proper coloring") {
+    std::mt19937 rng(17);
+    const std::size_t n = 400;
+    Graph g(n, Graph::Kind::Undirected);
+    for (int i = 0; i < 3000; ++i) {
+        auto u = rng() % n, v = rng() % n;
+        if (u != v) g.addEdge(u, v);
+    }
+    const auto deg = g.outDegree();
+    const std::size_t maxDeg = *std::max_element(deg.begin(), deg.end());
+    for (auto m : { GraphColoring::Method::LargestFirst, GraphColoring::Method::DSatur,
+                    GraphColoring::Method::JonesPlassmann }) {
+        GraphColoring::Options o; o.method = m;
+        auto r = GraphColoring(o).compute(g);
+        bool proper = true;
+        for (Graph::Vertex u = 0; u < n; ++u)
+            for (const auto& e : g.adj(u)) proper = proper && r.color[u] != r.color[e.first];
+        CHECK(proper);
+        CHECK(r.colors <= maxDeg + 1);
+    }
+    CHECK(run_algo("COLORING:jp,seed=4", g).find("Jones-Plassmann") != std::string::npos);
+}
+
+// ---------------- Maximum clique ----------------
+
+TEST_CASE("MaxClique finds a planted clique and matches brute force") {
+    std::mt19937 rng(23);
+    for (int round = 0; round < 20; ++round) {
+        const std::size_t n = 14;
+        Graph g(n, Graph::Kind::Undirected);
+        for (Graph::Vertex u = 0; u < n; ++u)
+            for (Graph::Vertex v = u + 1; v < n; ++v)
+                if (rng() % 2) g.addEdge(u, v);
+        std::size_t best = 0;                          // brute force over all subsets
+        for (unsigned m = 1; m < (1u << n); ++m) {
+            bool clique = true;
+            for (Graph::Vertex u = 0; u < n && clique; ++u)
+                for (Graph::Vertex v = u + 1; v < n && clique; ++v)
+                    if ((m >> u & 1) && (m >> v & 1)) clique = g.hasArc(u, v);
+            if (clique) best = std::max<std::size_t>(best, __builtin_popcount(m));
+        }
+        auto r = MaxClique().compute(g);
+        CHECK(r.optimal);
+        CHECK(r.clique.size() == best);
+        CHECK(r.colorBound >= best);
+        for (auto a : r.clique) for (auto b : r.clique) if (a < b) CHECK(g.hasArc(a, b));
+    }
+
+    Graph k(70, Graph::Kind::Directed);                // K6 on {10, 20, ..., 60} spans two words
+    for (Graph::Vertex u = 10; u <= 60; u += 10)
+        for (Graph::Vertex v = u + 10; v <= 60; v += 10) k.addEdge(u, v);
+    CHECK(run_algo("MAXCLIQUE", k).find("Maximum clique: size 6 [10 20 30 40 50 60]") != std::string::npos);
+}
+
+TEST_CASE("MaxClique stops at a cancelled token with its best clique so far") {
+    Graph g(40, Graph::Kind::Undirected);
+    for (Graph::Vertex u = 0; u < 40; ++u)
+        for (Graph::Vertex v = u + 1; v < 40; ++v) if ((u + v) % 3) g.addEdge(u, v);
+    MaxClique::Options o;
+    o.cancel.cancel();                                 // already expired
+    auto r = MaxClique(o).compute(g);
+    CHECK_FALSE(r.optimal);
+    for (auto a : r.clique) for (auto b : r.clique) if (a < b) CHECK(g.hasArc(a, b));
+    CHECK(AlgorithmFactory::create("MAXCLIQUE:timeout=-1") == nullptr);
+}
+
+// ---------------- PageRank ----------------
+
+TEST_CASE("PageRank on a directed 3-cycle is uniform and sums to 1") {
+    Graph g(3, Graph::Kind::Directed);
+    g.addEdge(0,1); g.addEdge(1,2); g.addEdge(2,0);
+
+    auto r = PageRank().compute(g);
+    CHECK(r.converged);
+    double sum = 0; for (double x : r.rank) { sum += x; CHECK(x == doctest::Approx(1.0/3)); }
+    CHECK(sum == doctest::Approx(1.0));
+    CHECK(r.iterationMs.size() == r.iterations);
+}
+
+TEST_CASE("PageRank blocked/reordered/float variants agree with the plain run") {
+    Graph g(6, Graph::Kind::Directed);                 // hub 0 + a dangling vertex 5
+    g.addEdge(1,0); g.addEdge(2,0); g.addEdge(3,0); g.addEdge(4,0);
+    g.addEdge(0,1); g.addEdge(1,2); g.addEdge(2,3); g.addEdge(3,5);
+
+    PageRank::Options plain; plain.tolerance = 1e-10; plain.maxIterations = 500;
+    auto ref = PageRank(plain).compute(g);
+    REQUIRE(ref.converged);
+
+    PageRank::Options tuned = plain; tuned.blockSize = 2; tuned.reorder = true;
+    auto blk = PageRank(tuned).compute(g);
+    CHECK(blk.blocks == 3);
+    for (std::size_t v = 0; v < 6; ++v) CHECK(blk.rank[v] == doctest::Approx(ref.rank[v]));
+
+    tuned.singlePrecision = true; tuned.tolerance = 1e-5;
+    auto fl = PageRank(tuned).compute(g);
+    for (std::size_t v = 0; v < 6; ++v) CHECK(fl.rank[v] == doctest::Approx(ref.rank[v]).epsilon(1e-3));
+}
+
+TEST_CASE("PageRank with many sparse blocks matches the single-block run") {
+    const std::size_t n = 3000;                        // one source per block: 3000 mostly empty blocks
+    Graph g(n, Graph::Kind::Directed);
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<std::size_t> pick(0, n - 1);
+    for (std::size_t i = 0; i < 4 * n; ++i) { auto u = pick(rng), v = pick(rng); if (u != v) g.addEdge(u, v); }
+
+    PageRank::Options plain; plain.tolerance = 1e-12; plain.maxIterations = 200;
+    auto ref = PageRank(plain).compute(g);
+    PageRank::Options tiny = plain; tiny.blockSize = 1;
+    auto blk = PageRank(tiny).compute(g);
+    CHECK(blk.blocks == n);
+    CHECK(blk.iterations == ref.iterations);
+    for (std::size_t v = 0; v < n; ++v) CHECK(blk.rank[v] == doctest::Approx(ref.rank[v]));
+}
+
+TEST_CASE("PageRank strategy reports convergence and honours the iteration cap") {
+    Graph g(3, Graph::Kind::Directed);
+    g.addEdge(0,1); g.addEdge(1,2); g.addEdge(2,0); g.addEdge(0,2);
+
+    CHECK(run_algo("PAGERANK", g).find("PageRank: converged") != std::string::npos);
+    CHECK(run_algo("PageRank:tol=0,iters=3", g).find("not converged after 3 iterations") != std::string::npos);
+    CHECK_FALSE(AlgorithmFactory::create("PAGERANK:bogus=1"));
+}
+
+// ---------------- Bipartite matching ----------------
+
+TEST_CASE("Matching finds a perfect matching on a 6-cycle with every seeding") {
+    Graph g(6, Graph::Kind::Undirected);
+    for (int i = 0; i < 6; ++i) g.addEdge(i, (i + 1) % 6);
+
+    for (auto init : { BipartiteMatching::Init::None, BipartiteMatching::Init::Greedy,
+                       BipartiteMatching::Init::KarpSipser }) {
+        BipartiteMatching::Options o; o.init = init;
+        auto r = BipartiteMatching(o).compute(g);
+        REQUIRE(r.bipartite);
+        CHECK(r.size == 3);
+        CHECK(r.pairs.size() == 3);
+        for (auto& p : r.pairs) CHECK(r.side[p.first] != r.side[p.second]);
+    }
+}
+
+TEST_CASE("Matching needs augmenting paths when greedy picks badly") {
+    // left {0,1}, right {3,4}; greedy takes 0-3 and leaves 1 stuck until 0 is re-routed to 4
+    Graph g(5, Graph::Kind::Directed);
+    g.addEdge(0,3); g.addEdge(0,4); g.addEdge(1,3);
+    BipartiteMatching::Options o; o.init = BipartiteMatching::Init::Greedy;
+    auto r = BipartiteMatching(o).compute(g);
+    CHECK(r.initialSize == 1);
+    CHECK(r.size == 2);
+    CHECK(r.phases == 1);
+}
+
+TEST_CASE("Matching strategy rejects odd cycles") {
+    Graph g(3, Graph::Kind::Undirected);
+    g.addEdge(0,1); g.addEdge(1,2); g.addEdge(2,0);
+    CHECK(run_algo("MATCHING", g).find("not bipartite") != std::string::npos);
+
+    Graph p(4, Graph::Kind::Undirected);
+    p.addEdge(0,1); p.addEdge(1,2); p.addEdge(2,3);
+    CHECK(run_algo("MATCHING:greedy", p).find("Maximum matching: 2 pairs") != std::string::npos);
+}
+
+// ---------------- Biconnectivity ----------------
+
+TEST_CASE("Biconnectivity on two triangles joined by a bridge") {
+    Graph g(6, Graph::Kind::Undirected);
+    g.addEdge(0,1); g.addEdge(1,2); g.addEdge(2,0);   // block A
+    g.addEdge(3,4); g.addEdge(4,5); g.addEdge(5,3);   // block B
+    g.addEdge(2,3);                                    // bridge
+
+    auto r = Biconnectivity().compute(g);
+    REQUIRE(r.bridges.size() == 1);
+    CHECK(r.bridges[0] == std::make_pair<Graph::Vertex, Graph::Vertex>(2, 3));
+    CHECK(r.articulationPoints == std::vector<Graph::Vertex>{2, 3});
+    CHECK(r.blocks == 3);
+    CHECK(r.edges.size() == 7);
+    CHECK(r.components == 1);
+    CHECK_FALSE(r.biconnected());
+}
+
+TEST_CASE("Biconnectivity handles a long path without recursion") {
+    const std::size_t n = 200000;                      // deep enough to overflow a recursive DFS
+    Graph g(n, Graph::Kind::Directed);
+    for (std::size_t i = 0; i + 1 < n; ++i) g.addEdge(i, i + 1);
+
+    auto r = Biconnectivity().compute(g);
+    CHECK(r.bridges.size() == n - 1);
+    CHECK(r.articulationPoints.size() == n - 2);
+    CHECK(r.blocks == n - 1);
+}
+
+TEST_CASE("Hamilton rejects cut vertices before backtracking") {
+    Graph g(5, Graph::Kind::Undirected);               // bow-tie: two triangles sharing vertex 2
+    g.addEdge(0,1); g.addEdge(1,2); g.addEdge(2,0);
+    g.addEdge(2,3); g.addEdge(3,4); g.addEdge(4,2);
+
+    CHECK(run_algo("HAMILTON", g).find("vertex 2 is an articulation point") != std::string::npos);
+    CHECK(run_algo("BICONNECTED", g).find("articulation points: 1 [2]") != std::string::npos);
+}
+
+// ---------------- BitMatrix ----------------
+
+TEST_CASE("BitMatrix rows are aligned, padded and match the adjacency") {
+    Graph g(130, Graph::Kind::Directed);
+    g.addEdge(0, 129); g.addEdge(0, 64); g.addEdge(5, 0); g.addEdge(5, 129); g.addEdge(129, 128, 3);
+
+    const BitMatrix& m = BitMatrix::of(g);
+    CHECK(m.rows() == 130);
+    CHECK(m.words() == 8);                             // 3 words padded to one 64-byte block
+    for (std::size_t r = 0; r < m.rows(); ++r)
+        CHECK(reinterpret_cast<std::uintptr_t>(m.row(r)) % BitMatrix::kAlign == 0);
+    CHECK(m.test(0, 129)); CHECK(m.test(0, 64)); CHECK(m.test(5, 0)); CHECK(m.test(129, 128));
+    CHECK_FALSE(m.test(129, 0));
+    CHECK(m.count(0) == 2);
+    CHECK(BitMatrix::nextSet(m.row(0), m.words(), 1) == 64);
+    CHECK(BitMatrix::nextSet(m.row(0), m.words(), 65) == 129);
+    CHECK(BitMatrix::nextSet(m.row(0), m.words(), 130) == BitMatrix::npos);
+
+    BitMatrix t(2, 130);
+    BitMatrix::andRows(t.row(0), m.row(0), m.row(5), m.words());
+    CHECK(BitMatrix::popcount(t.row(0), t.words()) == 1);
+    BitMatrix::orRows(t.row(1), m.row(0), m.row(5), m.words());
+    CHECK(BitMatrix::popcount(t.row(1), t.words()) == 3);
+    BitMatrix::andNotRows(t.row(1), t.row(1), m.row(0), m.words());
+    CHECK(BitMatrix::andCount(t.row(1), m.row(5), m.words()) == 1);
+}
+
+TEST_CASE("BitMatrix is cached per graph state and shared by copies") {
+    Graph g(4, Graph::Kind::Undirected);
+    g.addEdge(0, 1); g.addEdge(1, 2);
+
+    const BitMatrix* first = &BitMatrix::of(g);
+    CHECK(&BitMatrix::of(g) == first);                 // built once
+    Graph copy = g;
+    CHECK(&BitMatrix::of(copy) == first);              // copies share until modified
+
+    copy.addEdge(2, 3);
+    CHECK(&BitMatrix::of(g) == first);                 // the original keeps its view
+    CHECK(BitMatrix::of(copy).test(3, 2));
+    CHECK_FALSE(BitMatrix::of(g).test(3, 2));
+
+    CHECK(g.removeEdge(0, 1));
+    CHECK_FALSE(BitMatrix::of(g).test(1, 0));
+    CHECK_FALSE(g.removeEdge(0, 3));                   // no-op keeps the cache
+}
+
+TEST_CASE("A moved-from graph is empty and keeps a usable cache") {
+    Graph g(3, Graph::Kind::Directed);
+    g.addEdge(0, 1); g.addEdge(1, 2);
+    const Csr* view = &Csr::of(g);
+    Graph moved = std::move(g);
+    CHECK(&Csr::of(moved) == view);                    // the cache travels with the edges
+    CHECK(g.n() == 0);
+    CHECK(g.m() == 0);
+    CHECK(Csr::of(g).arcs() == 0);                     // fresh cache, not a null one
+
+    Graph other(2, Graph::Kind::Directed);
+    other = std::move(moved);
+    CHECK(other.m() == 2);
+    CHECK(moved.n() == 0);
+    CHECK(Csr::of(moved).arcs() == 0);
+    moved = Graph(2, Graph::Kind::Directed);           // reusable after a move
+    moved.addEdge(0, 1);
+    CHECK(Csr::of(moved).arcs() == 1);
+}
+
+TEST_CASE("Dense and sparse Hamilton/MaxFlow paths agree") {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> cap(0, 9);
+    for (int round = 0; round < 20; ++round) {
+        const std::size_t k = 12, big = 600;           // big pads k vertices into a sparse graph
+        const auto at = [&](std::size_t v) { return v + 1 == k ? big - 1 : v; };
+        Graph d(k, Graph::Kind::Directed), s(big, Graph::Kind::Directed);
+        for (std::size_t u = 0; u < k; ++u)
+            for (std::size_t v = 0; v < k; ++v)
+                if (u != v && rng() % 2) {
+                    const int w = cap(rng);
+                    d.addEdge(u, v, w); s.addEdge(at(u), at(v), w);
+                }
+        REQUIRE(BitMatrix::preferred(d));
+        REQUIRE_FALSE(BitMatrix::preferred(s));
+        const std::string fd = run_algo("MAXFLOW", d), fs = run_algo("MAXFLOW", s);
+        CHECK(fd.substr(fd.find(": ")) == fs.substr(fs.find(": ")));
+    }
+
+    Graph ring(1000, Graph::Kind::Undirected);         // sparse: adjacency lists win
+    for (std::size_t i = 0; i < 1000; ++i) ring.addEdge(i, (i + 1) % 1000);
+    REQUIRE_FALSE(BitMatrix::preferred(ring));
+    const std::string out = run_algo("HAMILTON", ring);
+    CHECK(out.find("Hamiltonian circuit: 0 -> 1 -> 2 -> ") == 0);
+    CHECK(out.find("998 -> 999 -> 0") != std::string::npos);
+
+    Graph k5(5, Graph::Kind::Undirected);              // dense: bit rows
+    for (std::size_t u = 0; u < 5; ++u)
+        for (std::size_t v = u + 1; v < 5; ++v) k5.addEdge(u, v);
+    REQUIRE(BitMatrix::preferred(k5));
+    CHECK(run_algo("HAMILTON", k5) == "Hamiltonian circuit: 0 -> 1 -> 2 -> 3 -> 4 -> 0");
+}
+
+// ---------------- Artifact cache ----------------
+
+TEST_CASE("Derived views are built once and shared until the graph changes") {
+    Graph g(4, Graph::Kind::Directed);
+    g.addEdge(0, 1); g.addEdge(1, 2); g.addEdge(2, 0); g.addEdge(2, 3);
+
+    CHECK(&g.outDegree() == &g.outDegree());
+    CHECK(g.inDegree() == std::vector<std::size_t>{1, 1, 1, 1});
+    CHECK(g.reversedView().hasArc(3, 2));
+    CHECK(&Csr::of(g) == &Csr::of(g));
+    CHECK(Csr::of(g, Csr::View::In).degree(0) == 1);
+    CHECK(Csr::of(g, Csr::View::Symmetric).degree(2) == 3);
+    CHECK(StrongComponents::of(g).count == 2);
+
+    std::vector<const void*> seen(8);                  // concurrent first use yields one artifact
+    Graph h = g; h.addEdge(3, 0);
+    std::vector<std::thread> ts;
+    for (std::size_t i = 0; i < seen.size(); ++i)
+        ts.emplace_back([&, i]{ seen[i] = i % 2 ? static_cast<const void*>(&Csr::of(h, Csr::View::Symmetric))
+                                                : static_cast<const void*>(&StrongComponents::of(h)); });
+    for (auto& t : ts) t.join();
+    for (std::size_t i = 2; i < seen.size(); ++i) CHECK(seen[i] == seen[i % 2]);
+    CHECK(StrongComponents::of(h).count == 1);
+    CHECK(StrongComponents::of(g).count == 2);         // the original keeps its own views
+
+    g.addEdge(3, 1);
+    CHECK(g.inDegree()[1] == 2);
+    CHECK(Csr::of(g).arcs() == 5);
+    CHECK(g.reversedView().hasArc(1, 3));
+    CHECK(StrongComponents::of(g).count == 1);
+}
+
+TEST_CASE("MST rejects disconnected graphs via the shared component labels") {
+    Graph g(4, Graph::Kind::Undirected);
+    g.addEdge(0, 1, 2); g.addEdge(2, 3, 5);
+    CHECK(run_algo("SCC", g) == "SCC count: 2.");
+    CHECK(run_algo("MST", g) == "Graph is disconnected; MST does not exist.");
+    g.addEdge(1, 2, 1);
+    CHECK(run_algo("MST", g).find("MST weight: 8") == 0);
+}
+
+// ---------------- Fork-join ----------------
+
+TEST_CASE("parallel_invoke runs every task once, also with a single thread") {
+    for (unsigned cap : {0u, 1u, 2u}) {
+        std::vector<int> hits(5, 0);
+        std::vector<std::function<void()>> tasks;
+        for (std::size_t i = 0; i < hits.size(); ++i) tasks.emplace_back([&, i]{ ++hits[i]; });
+        parallel_invoke(tasks, cap);
+        CHECK(hits == std::vector<int>(5, 1));
+    }
+
+    std::atomic<int> inner{0};                         // nested fork-join from pool workers finishes
+    std::vector<std::function<void()>> outer(4, [&]{
+        parallel_invoke(std::vector<std::function<void()>>(3, [&]{ ++inner; }), 1 + ThreadPool::shared().idle());
+    });
+    parallel_invoke(outer);
+    CHECK(inner.load() == 12);
+}
+
+// ---------------- Topology and placement ----------------
+
+TEST_CASE("Topology reads sysfs nodes and placements map threads to CPUs") {
+    CHECK(parse_cpu_list("0-3,8,10-11\n") == std::vector<int>{0, 1, 2, 3, 8, 10, 11});
+    CHECK_THROWS_AS(parse_cpu_list("3-1"), std::invalid_argument);
+    CHECK_THROWS_AS(parse_cpu_list("a"), std::invalid_argument);
+
+    // Fake two-socket machine: node0 = 0-3, node1 = 4-7, plus a memory-only node2.
+    namespace fs = std::filesystem;
+    const fs::path root = fs::temp_directory_path() / ("topo_test_" + std::to_string(::getpid()));
+    const char* lists[] = {"0-3\n", "4-7\n", "\n"};
+    for (int n = 0; n < 3; ++n) {
+        fs::create_directories(root / "node" / ("node" + std::to_string(n)));
+        std::ofstream(root / "node" / ("node" + std::to_string(n)) / "cpulist") << lists[n];
+    }
+    std::ofstream(root / "node" / "online") << "0-2\n";         // not a node directory
+
+    const Topology topo = Topology::fromSysfs(root.string());
+    REQUIRE(topo.nodes.size() == 3);
+    CHECK(topo.cpuNodes() == 2);
+    CHECK(topo.nodeOf(5) == 1);
+    CHECK(topo.nodeOf(9) == -1);
+    CHECK(Topology::fromSysfs(root.string(), {1, 2, 6}).cpus() == std::vector<int>{1, 2, 6});
+    CHECK(Topology::fromSysfs((root / "missing").string(), {0, 1}).nodes.size() == 1); // flat fallback
+    fs::remove_all(root);
+
+    const auto compact = CpuPlacement::parse("compact");
+    const auto scatter = CpuPlacement::parse("scatter");
+    CHECK(compact.cpusFor(1, topo) == std::vector<int>{1});
+    CHECK(compact.cpusFor(9, topo) == std::vector<int>{1});    // wraps around
+    CHECK(scatter.cpusFor(0, topo) == std::vector<int>{0});
+    CHECK(scatter.cpusFor(1, topo) == std::vector<int>{4});    // alternates sockets
+    CHECK(scatter.cpusFor(3, topo) == std::vector<int>{5});
+    CHECK(CpuPlacement::parse("node:1").cpusFor(0, topo) == std::vector<int>{4, 5, 6, 7});
+    CHECK(CpuPlacement::parse("cpus:2,6").cpusFor(3, topo) == std::vector<int>{6});
+    CHECK(CpuPlacement::parse("none").cpusFor(0, topo).empty());
+    CHECK(CpuPlacement::parse("cpus:0-1").describe() == "cpus:0,1");
+    CHECK_THROWS_AS(CpuPlacement::parse("node:"), std::invalid_argument);
+    CHECK_THROWS_AS(CpuPlacement::parse("socket"), std::invalid_argument);
+    CHECK(MemoryPlacement::parse("node:1").describe() == "node:1");
+    CHECK_THROWS_AS(MemoryPlacement::parse("spread"), std::invalid_argument);
+}
+
+TEST_CASE("Pinning restricts a thread and memory placement keeps graph views intact") {
+    const Topology& sys = Topology::system();
+    REQUIRE(!sys.cpus().empty());
+    const int last = sys.cpus().back();
+
+    bool pinned = false;
+    cpu_set_t seen;
+    CPU_ZERO(&seen);
+    std::thread t([&] {
+        pinned = CpuPlacement::parse("cpus:" + std::to_string(last)).pinThis(0);
+        ::sched_getaffinity(0, sizeof(seen), &seen);
+    });
+    t.join();
+    CHECK(pinned);
+    CHECK(CPU_COUNT(&seen) == 1);
+    CHECK(CPU_ISSET(last, &seen));
+
+    // Placement only moves pages (and may be refused, e.g. under seccomp):
+    // the cached views must read the same either way.
+    auto build = [] {                                            // ~40k arcs: several pages per array
+        Graph g(3000, Graph::Kind::Directed, Graph::Options{true, true});
+        std::mt19937 rng(5);
+        for (int i = 0; i < 40000; ++i) g.addEdge(rng() % 3000, rng() % 3000, 1 + rng() % 9);
+        return g;
+    };
+    const Csr plain = Csr::fromGraph(build());
+    for (const char* spec : {"interleave", "local", "node:0"}) {
+        MemoryPlacement::setGraphs(MemoryPlacement::parse(spec));
+        const Graph g = build();                                 // fresh cache: views built under `spec`
+        const Csr& c = Csr::of(g);
+        CHECK(c.offsets == plain.offsets);
+        CHECK(c.targets == plain.targets);
+        CHECK(c.weights == plain.weights);
+    }
+    MemoryPlacement::setGraphs(MemoryPlacement{});
+}
+
+TEST_CASE("Big arrays are huge-page aligned, accounted and released") {
+    CHECK(BigAlloc::describe(BigAlloc::parse("hugetlb+prefault")) == "hugetlb+prefault");
+    CHECK(BigAlloc::parse("off").mode == BigAlloc::Mode::Off);
+    CHECK_THROWS_AS(BigAlloc::parse("+prefault"), std::invalid_argument);
+    CHECK_THROWS_AS(BigAlloc::parse("huge"), std::invalid_argument);
+
+    const BigAlloc::Policy saved = BigAlloc::policy();
+    const BigAlloc::Stats before = BigAlloc::stats();
+    for (const char* spec : {"off", "thp+prefault", "hugetlb"}) {
+        BigAlloc::setPolicy(BigAlloc::parse(spec));
+        {
+            BigArray<std::uint32_t> big(1u << 20, 7);               // 4 MiB: mapped
+            BigArray<std::uint32_t> small(1000, 7);                 // heap
+            CHECK(reinterpret_cast<std::uintptr_t>(big.data()) % BigAlloc::kHugePage == 0);
+            CHECK(big[123456] == 7);
+            CHECK(BigAlloc::stats().bytes == before.bytes + (4u << 20));
+            CHECK(BigAlloc::stats().blocks == before.blocks + 1);
+            big.push_back(8);                                       // grows into a new mapping
+            CHECK(big.back() == 8);
+        }
+        CHECK(BigAlloc::stats().bytes == before.bytes);             // every mapping released
+        CHECK(BigAlloc::stats().blocks == before.blocks);
+    }
+    const BigAlloc::Stats after = BigAlloc::stats();
+    CHECK((after.hugetlb - before.hugetlb) + (after.fallbacks - before.fallbacks) == 2); // pool or fallback
+    BigAlloc::setPolicy(saved);
+}
+
+// ---------------- Asynchronous logging ----------------
+
+// Flush the logger and return everything written to `f` so far as lines.
+static std::vector<std::string> log_lines(std::FILE* f) {
+    AsyncLog::flush();
+    std::fflush(f);
+    std::rewind(f);
+    std::string all;
+    char buf[4096];
+    for (std::size_t n; (n = std::fread(buf, 1, sizeof(buf), f)) > 0;) all.append(buf, n);
+    std::vector<std::string> lines;
+    std::istringstream iss(all);
+    for (std::string l; std::getline(iss, l);) lines.push_back(l);
+    return lines;
+}
+
+TEST_CASE("Async logger formats records, honours levels and samples") {
+    std::FILE* f = std::tmpfile();
+    REQUIRE(f != nullptr);
+    AsyncLog::setSink(f);
+    AsyncLog::setLevel(LogLevel::Info);
+
+    LOG_DEBUG("hidden {}", 1);
+    LOG_INFO("fd={} n={} cmd: {} {}", -3, 7u, std::string("ALG MST"), true);
+    LOG_WARN("{} left", std::string_view("nothing"));
+    LOG_INFO("long: {}", std::string(400, 'x'));
+    for (int i = 0; i < 10; ++i) LOG_EVERY_N(LogLevel::Info, 4, "sample {}", i);
+    const char* none = nullptr;
+    LOG_INFO("peer: {}", none);
+
+    const auto lines = log_lines(f);
+    REQUIRE(lines.size() == 7);
+    CHECK(lines[0] == "fd=-3 n=7 cmd: ALG MST 1");
+    CHECK(lines[1] == "[warn] nothing left");
+    CHECK(lines[2].size() < 200);                      // truncated to the record...
+    CHECK(lines[2].substr(lines[2].size() - 4) == " ..."); // ...and marked
+    CHECK(lines[3] == "sample 0");
+    CHECK(lines[4] == "sample 4");
+    CHECK(lines[5] == "sample 8");
+    CHECK(lines[6] == "peer: (null)");
+
+    AsyncLog::setSink(nullptr);                        // back to stdout
+    std::fclose(f);
+}
+
+TEST_CASE("Async logger keeps every thread's records and accounts for losses") {
+    std::FILE* f = std::tmpfile();
+    REQUIRE(f != nullptr);
+    AsyncLog::setSink(f);
+    const auto before = AsyncLog::stats();
+
+    std::vector<std::thread> ts;                       // fits the rings: nothing may be lost
+    for (int t = 0; t < 4; ++t)
+        ts.emplace_back([t]{ for (int i = 0; i < 200; ++i) LOG_INFO("t{} i{}", t, i); });
+    for (auto& t : ts) t.join();
+    auto lines = log_lines(f);
+    CHECK(lines.size() == 800);
+    for (int t = 0; t < 4; ++t) {                      // each thread's records, complete and in order
+        const std::string prefix = "t" + std::to_string(t) + " i";
+        std::vector<int> seq;
+        for (const auto& l : lines)
+            if (l.rfind(prefix, 0) == 0) seq.push_back(std::stoi(l.substr(prefix.size())));
+        std::vector<int> expect(200);
+        for (int i = 0; i < 200; ++i) expect[i] = i;
+        CHECK(seq == expect);
+    }
+
+    const auto mid = AsyncLog::stats();                // a burst larger than one ring
+    for (int i = 0; i < 5000; ++i) LOG_INFO("burst {}", i);
+    for (int i = 0; i < 10; ++i) LOG_RATE_LIMITED(LogLevel::Info, 3, "rate {}", i);
+    log_lines(f);
+    const auto after = AsyncLog::stats();
+    CHECK(mid.written - before.written == 800);
+    CHECK((after.written - mid.written) + (after.dropped - mid.dropped) + (after.suppressed - mid.suppressed) == 5010);
+    CHECK(after.suppressed - mid.suppressed >= 4);     // at most 3 per second (two windows at worst)
+
+    AsyncLog::setSink(nullptr);
+    std::fclose(f);
+}
+
+// ---------------- Small-graph batches ----------------
+
+TEST_CASE("Small-graph kernels reproduce the regular strategies") {
+    std::mt19937 rng(11);
+    SmallGraphBatch batch;
+    for (int i = 0; i < 300; ++i) {
+        const std::size_t n = 1 + rng() % 10;
+        const bool directed = rng() % 2;
+        const unsigned density = 1 + rng() % 4;            // roughly 1/4 .. 4/4 of all pairs
+        batch.addGraph(n, directed);
+        for (std::size_t u = 0; u < n; ++u)
+            for (std::size_t v = directed ? 0 : u + 1; v < n; ++v)
+                if (u != v && rng() % 4 < density) CHECK(batch.addEdge(u, v, rng() % 6));
+    }
+    batch.addGraph(64, false);                             // full-width masks: a 64-ring
+    for (std::size_t v = 0; v < 64; ++v) batch.addEdge(v, (v + 1) % 64, 2);
+
+    for (auto id : { AlgorithmId::Mst, AlgorithmId::Scc, AlgorithmId::MaxFlow, AlgorithmId::Hamilton,
+                     AlgorithmId::Diameter }) {
+        CHECK(SmallGraphBatch::hasKernel(id) == (id != AlgorithmId::Diameter));
+        const auto out = batch.run(id);
+        REQUIRE(out.size() == batch.size());
+        for (std::size_t i = 0; i < batch.size(); ++i)
+            CHECK(out[i] == AlgorithmFactory::run(id, batch.graph(i)));
+    }
+}
+
+TEST_CASE("Small-graph batch rejects bad input and reuses its arena") {
+    SmallGraphBatch batch;
+    CHECK_FALSE(batch.addEdge(0, 1));                      // no graph yet
+    CHECK_THROWS_AS(batch.addGraph(65, false), std::invalid_argument);
+    batch.addGraph(3, false);
+    CHECK(batch.addEdge(0, 1));
+    CHECK_FALSE(batch.addEdge(1, 0));                      // duplicate undirected edge
+    CHECK_FALSE(batch.addEdge(2, 2));                      // self-loop
+    CHECK_FALSE(batch.addEdge(0, 3));                      // out of range
+    CHECK(batch.row(0, 1) == 0b001);
+    batch.clear();
+    CHECK(batch.size() == 0);
+    batch.addGraph(2, true);
+    CHECK(batch.addEdge(1, 0, 7));
+    CHECK(batch.run(AlgorithmId::MaxFlow).front() == "Max flow (0 -> 1): 0.");
+}
+
+// ---------------- Frontier engine ----------------
+
+TEST_CASE("Vertex subsets convert between forms and frontier BFS matches a plain BFS") {
+    auto s = VertexSubset::fromIds(10, { 7, 2, 5 });
+    CHECK_FALSE(s.dense());
+    CHECK(s.contains(5));
+    s.toDense();
+    CHECK((s.dense() && s.size() == 3 && s.flags()[7] && !s.flags()[3]));
+    s.toSparse();
+    CHECK(s.ids() == std::vector<VertexSubset::Index>{ 2, 5, 7 });     // ascending after a round trip
+    CHECK(vertexFilter(VertexSubset::all(10), [](VertexSubset::Index v) { return v % 3 == 0; }).size() == 4);
+
+    std::mt19937 rng(5);
+    const std::size_t n = 3000;
+    Graph g(n, Graph::Kind::Directed);
+    for (Graph::Vertex v = 1; v <= 3; ++v) g.addEdge(0, v);          // the source is not a sink
+    for (int i = 0; i < 9000; ++i) {
+        auto u = rng() % n, v = rng() % n;
+        if (u != v) g.addEdge(u, v);
+    }
+    std::vector<long long> d(n, -1); std::vector<Graph::Vertex> q{ 0 }; d[0] = 0;
+    for (std::size_t i = 0; i < q.size(); ++i)
+        for (const auto& e : g.adj(q[i]))
+            if (d[e.first] < 0) { d[e.first] = d[q[i]] + 1; q.push_back(e.first); }
+
+    for (std::size_t divisor : { std::size_t{ 20 }, std::size_t{ 1 } << 40 }) {  // mixed / pull-only
+        EdgeMapOptions o; o.denseDivisor = divisor;
+        auto r = FrontierBfs(o).compute(g, 0);
+        CHECK(r.level == d);
+        CHECK(r.reached == q.size());
+        CHECK(r.reached > n / 2);
+        CHECK(r.denseRounds > 0);
+        if (divisor > 20) CHECK(r.denseRounds == r.rounds);
+        else CHECK(r.denseRounds < r.rounds);                         // starts and ends in push mode
+        for (std::size_t v = 1; v < n; ++v)                           // parents are one level up
+            if (d[v] > 0) CHECK(d[static_cast<std::size_t>(r.parent[v])] == d[v] - 1);
+    }
+    CHECK_THROWS_AS(FrontierBfs().compute(g, n), std::out_of_range);
+    Graph path(4, Graph::Kind::Undirected);
+    path.addEdge(0, 1); path.addEdge(1, 2);
+    CHECK(run_algo("BFS:source=1", path).find("reached 3 of 4 vertices, depth 1 (2 rounds, ") != std::string::npos);
+    CHECK(run_algo("BFS:source=1", path).find("0=1 1=0 2=1 3=inf") != std::string::npos);
+    CHECK(AlgorithmFactory::create("BFS:divisor=0") == nullptr);
+}
+
+TEST_CASE("Frontier components and PageRank agree with the reference implementations") {
+    std::mt19937 rng(8);
+    const std::size_t n = 2000;
+    Graph g(n, Graph::Kind::Directed);
+    for (int i = 0; i < 1500; ++i) {                                  // sparse: many components
+        auto u = rng() % n, v = rng() % n;
+        if (u != v) g.addEdge(u, v);
+    }
+    std::vector<std::size_t> parent(n);                               // union-find, min-id roots
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&](std::size_t x) { while (parent[x] != x) x = parent[x] = parent[parent[x]]; return x; };
+    for (std::size_t u = 0; u < n; ++u)
+        for (const auto& e : g.adj(u)) {
+            auto a = find(u), b = find(e.first);
+            if (a != b) parent[std::max(a, b)] = std::min(a, b);
+        }
+    auto cc = FrontierComponents().compute(g);
+    std::size_t roots = 0;
+    for (std::size_t v = 0; v < n; ++v) {
+        CHECK(cc.label[v] == find(v));
+        if (find(v) == v) ++roots;
+    }
+    CHECK(cc.components == roots);
+    Graph two(5, Graph::Kind::Undirected);
+    two.addEdge(3, 4); two.addEdge(1, 2);
+    CHECK(run_algo("COMPONENTS", two).find("Components: 3 (") != std::string::npos);
+    CHECK(run_algo("COMPONENTS", two).find("0=0 1=1 2=1 3=3 4=3") != std::string::npos);
+
+    PageRank::Options o; o.tolerance = 1e-10; o.maxIterations = 500;
+    auto ref = PageRank(o).compute(g);
+    auto eng = FrontierPageRank(o).compute(g);
+    REQUIRE(eng.converged);
+    CHECK(eng.iterations == ref.iterations);
+    for (std::size_t v = 0; v < n; v += 7) CHECK(eng.rank[v] == doctest::Approx(ref.rank[v]));
+    CHECK(run_algo("PAGERANK:engine", g).find("frontier engine); top:") != std::string::npos);
+}
+
+TEST_CASE("Concurrent pushes list each lowered vertex once") {
+    const std::size_t sources = 1024, targets = 64, n = 80000;       // every source hits every target
+    Graph g(n, Graph::Kind::Directed);
+    for (std::size_t u = 0; u < sources; ++u)
+        for (std::size_t t = 0; t < targets; ++t) g.addEdge(u, sources + t);
+    for (std::size_t v = 2000; v + 1 < n; ++v) g.addEdge(v, v + 1);  // padding: keeps the round in push mode
+    const FrontierGraph G = FrontierGraph::of(g);
+    REQUIRE(parallel_slots() >= 2);
+
+    std::vector<std::atomic<VertexSubset::Index>> label(n);
+    std::vector<std::atomic<std::uint8_t>> claimed(n);
+    MinLabelF f{label, claimed};
+    EdgeMapOptions o; o.denseDivisor = 1;
+    std::vector<VertexSubset::Index> ids(sources);
+    std::iota(ids.begin(), ids.end(), 0);
+    for (int rep = 0; rep < 20; ++rep) {
+        for (std::size_t v = 0; v < n; ++v) { label[v] = static_cast<VertexSubset::Index>(v); claimed[v] = 0; }
+        auto U = VertexSubset::fromIds(n, ids);
+        auto next = edgeMap(G, U, f, o);
+        REQUIRE_FALSE(next.dense());
+        auto out = next.ids();
+        std::sort(out.begin(), out.end());
+        CHECK(std::adjacent_find(out.begin(), out.end()) == out.end());
+        CHECK(next.size() == targets);
+        for (std::size_t t = 0; t < targets; ++t) CHECK(label[sources + t] == 0);
+    }
+}
+
+// ---------------- Sparse linear algebra ----------------
+
+TEST_CASE("Semiring SpMV and SpMSpV agree, honour masks and compose into PageRank") {
+    std::mt19937 rng(12);
+    const std::size_t n = 1500;
+    Graph g(n, Graph::Kind::Directed);
+    for (int i = 0; i < 6000; ++i) {
+        auto u = rng() % n, v = rng() % n;
+        if (u != v) g.addEdge(u, v, 1 + static_cast<Graph::Weight>(rng() % 9));
+    }
+    const FrontierGraph A = FrontierGraph::of(g);
+
+    std::vector<long long> ones(n, 1), indeg;                        // (+, second): in-degrees
+    spmv<semiring::PlusSecond<long long>>(A, ones, indeg);
+    for (std::size_t v = 0; v < n; v += 11) CHECK(indeg[v] == static_cast<long long>(A.in.degree(v)));
+
+    SparseVector<long long> x;                                        // (min, +) on a sparse x
+    x.n = n;
+    std::vector<long long> dense(n, semiring::MinPlus<long long>::zero()), y;
+    for (std::size_t u = 3; u < n; u += 17) { x.ids.push_back(u); x.values.push_back(u % 5); dense[u] = u % 5; }
+    std::vector<std::uint8_t> odd(n, 0);
+    for (std::size_t v = 1; v < n; v += 2) odd[v] = 1;
+    spmv<semiring::MinPlus<long long>>(A, dense, y, Mask::skip(odd));
+    const auto sy = spmspv<semiring::MinPlus<long long>>(A, x, Mask::skip(odd));
+    CHECK(std::is_sorted(sy.ids.begin(), sy.ids.end()));
+    std::size_t finite = 0;
+    for (std::size_t k = 0; k < sy.nnz(); ++k) CHECK((sy.ids[k] % 2 == 0 && sy.values[k] == y[sy.ids[k]]));
+    for (std::size_t v = 0; v < n; v += 2) finite += y[v] != semiring::MinPlus<long long>::zero();
+    CHECK(sy.nnz() == finite);
+    for (std::size_t v = 1; v < n; v += 2) CHECK(y[v] == semiring::MinPlus<long long>::zero());  // untouched
+
+    SpmspvWorkspace<long long> ws;                                    // reused scratch gives the same products
+    for (int rep = 0; rep < 2; ++rep) {
+        const auto wy = spmspv<semiring::MinPlus<long long>>(A, x, ws, Mask::skip(odd));
+        CHECK(wy.ids == sy.ids);
+        CHECK(wy.values == sy.values);
+        CHECK(std::count(ws.seen.begin(), ws.seen.end(), 0) == static_cast<long>(n)); // touched entries reset
+    }
+
+    PageRank::Options o; o.tolerance = 1e-12; o.maxIterations = 60; // PageRank as x·A rounds
+    const auto ref = PageRank(o).compute(g);
+    std::vector<double> rank(n, 1.0 / n), contrib(n), sum;
+    for (std::size_t it = 0; it < ref.iterations; ++it) {
+        double dangling = 0;
+        for (std::size_t u = 0; u < n; ++u) {
+            const auto deg = A.out.degree(u);
+            contrib[u] = deg ? rank[u] / deg : 0.0;
+            if (!deg) dangling += rank[u];
+        }
+        spmv<semiring::PlusSecond<double>>(A, contrib, sum);
+        for (std::size_t v = 0; v < n; ++v) rank[v] = (1 - o.damping) / n + o.damping * (dangling / n + sum[v]);
+    }
+    for (std::size_t v = 0; v < n; v += 13) CHECK(rank[v] == doctest::Approx(ref.rank[v]));
+}
+
+TEST_CASE("Min-plus shortest paths match Bellman-Ford and detect negative cycles") {
+    std::mt19937 rng(21);
+    const std::size_t n = 800;
+    std::vector<Graph::Weight> pot(n);                                // w + pot[u] - pot[v]: negative
+    for (auto& p : pot) p = static_cast<Graph::Weight>(rng() % 30);  // arcs, but no negative cycle
+    Graph g(n, Graph::Kind::Directed);
+    for (int i = 0; i < 4000; ++i) {
+        auto u = rng() % n, v = rng() % n;
+        if (u != v) g.addEdge(u, v, static_cast<Graph::Weight>(rng() % 20) + pot[u] - pot[v]);
+    }
+    std::vector<long long> best(n, ShortestPaths::kUnreached);       // plain Bellman-Ford on the lists
+    best[0] = 0;
+    for (std::size_t round = 0; round < n; ++round)
+        for (std::size_t u = 0; u < n; ++u)
+            if (best[u] != ShortestPaths::kUnreached)
+                for (const auto& e : g.adj(u))
+                    best[e.first] = std::min(best[e.first], best[u] + e.second);
+
+    for (std::size_t divisor : { std::size_t{ 20 }, std::size_t{ 1 } << 40 }) {  // mixed / dense-only
+        EdgeMapOptions opt; opt.denseDivisor = divisor;
+        const auto r = ShortestPaths(opt).compute(g, 0);
+        CHECK_FALSE(r.negativeCycle);
+        CHECK(r.dist == best);
+        CHECK(r.reached > n / 2);
+        if (divisor > 20) CHECK(r.denseRounds == r.rounds);
+        else CHECK(r.denseRounds < r.rounds);
+    }
+
+    Graph small(4, Graph::Kind::Directed);
+    small.addEdge(0, 1, 4); small.addEdge(0, 2, 1); small.addEdge(2, 1, 2);
+    CHECK(run_algo("SSSP", small).find("reached 3 of 4 vertices") != std::string::npos);
+    CHECK(run_algo("SSSP", small).find("dist: 0=0 1=3 2=1 3=inf") != std::string::npos);
+    small.addEdge(1, 0, -4);
+    CHECK(run_algo("SSSP:source=2", small).find("negative cycle") != std::string::npos);
+    CHECK(run_algo("SSSP:source=9", small).find("out of range") != std::string::npos);
+    CHECK_THROWS_AS(ShortestPaths().compute(small, 4), std::out_of_range);
+}
+
 // ---------------- Factory ----------------
 
 TEST_CASE("Factory recognizes algorithm names (case-insensitive)") {
@@ -103,6 +1128,31 @@ TEST_CASE("Factory recognizes algorithm names (case-insensitive)") {
     CHECK(AlgorithmFactory::create("MaxFlow"));
     CHECK(AlgorithmFactory::create("HAMILTON"));
     CHECK_FALSE(AlgorithmFactory::create("not_an_algo"));
+    CHECK_FALSE(AlgorithmFactory::create("MST junk"));              // no options to take
+    CHECK_FALSE(AlgorithmFactory::create("HAMILTON:1"));
+    CHECK_FALSE(AlgorithmFactory::create(AlgorithmId::MaxFlow, {"x"}));
+}
+
+TEST_CASE("Registry ids round-trip and static dispatch matches the factory") {
+    for (std::size_t i = 0; i < kAlgorithmCount; ++i) {
+        const auto id = static_cast<AlgorithmId>(i);
+        std::string lowered(AlgorithmFactory::name(id));
+        for (auto& c : lowered) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        AlgorithmId back{};
+        REQUIRE(AlgorithmFactory::parseId(lowered, back));
+        CHECK(back == id);
+    }
+    AlgorithmId id{};
+    CHECK_FALSE(AlgorithmFactory::parseId("MS", id));
+    CHECK_FALSE(AlgorithmFactory::parseId("MSTX", id));
+
+    Graph g(5, Graph::Kind::Undirected);
+    g.addEdge(0, 1, 2); g.addEdge(1, 2, 1); g.addEdge(2, 3, 4); g.addEdge(3, 4, 3); g.addEdge(4, 0, 5);
+    for (auto a : { AlgorithmId::Mst, AlgorithmId::Scc, AlgorithmId::MaxFlow, AlgorithmId::Hamilton,
+                    AlgorithmId::Biconnected, AlgorithmId::Diameter, AlgorithmId::Coloring })
+        CHECK(AlgorithmFactory::run(a, g) == run_algo(std::string(AlgorithmFactory::name(a)).c_str(), g));
+    CHECK(AlgorithmFactory::create(AlgorithmId::Scc, {"dag"}));
+    CHECK_FALSE(AlgorithmFactory::create(AlgorithmId::Scc, {"nope"}));
 }
 
 TEST_CASE("IGraphAlgorithm dtor is exercised") {
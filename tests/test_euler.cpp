@@ -165,6 +165,28 @@ TEST_CASE("adj() out_of_range throws") {
     CHECK_THROWS_AS((void)g.adj(2), std::out_of_range); // invalid index 2
 }
 
+// ---------------------------
+// Test 12b: per-edge costs follow their arcs
+// ---------------------------
+TEST_CASE("Graph costs are optional and survive reversed()/removeEdge()") {
+    Graph g(3, Graph::Kind::Directed);
+    g.addEdge(0,1,4);                     // no cost yet
+    CHECK_FALSE(g.hasCosts());
+    CHECK(g.cost(0,0) == 0);
+    g.addEdge(0,2,5,-3);                  // first cost materializes the arrays
+    g.addEdge(1,2,6,7);
+    CHECK(g.hasCosts());
+    CHECK(g.cost(0,0) == 0);              // earlier arc defaults to 0
+    CHECK(g.cost(0,1) == -3);
+    Graph r = g.reversed();
+    CHECK(r.adj(2).size() == 2);
+    CHECK(r.cost(2,0) == -3);             // 2->0 (from 0->2)
+    CHECK(r.cost(2,1) == 7);              // 2->1 (from 1->2)
+    CHECK(g.removeEdge(0,1));
+    CHECK(g.cost(0,0) == -3);             // slot shifted with its arc
+    CHECK_THROWS_AS((void)g.cost(0,1), std::out_of_range);
+}
+
 // ---------------------------
 // Test 13: trivial undirected graph (no edges)
 // ---------------------------